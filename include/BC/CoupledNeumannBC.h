@@ -16,6 +16,7 @@
 #define COUPLEDNEUMANNBC_H
 
 #include "IntegratedBC.h"
+#include "PressureHistory.h"
 
 //Forward Declarations
 
@@ -42,6 +43,10 @@ private:
 
  const VariableValue & _some_var_val;
 
+  ///Tabulated value replacing some_var, if given
+  const PressureHistory * _history;
+  unsigned int _segment;
+
 };
 
 #endif //COUPLEDNEUMANNBC_H
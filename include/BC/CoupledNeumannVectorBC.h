@@ -16,6 +16,7 @@
 #define COUPLEDNEUMANNVECTORBC_H
 
 #include "IntegratedBC.h"
+#include "PressureHistory.h"
 
 //Forward Declarations
 
@@ -44,6 +45,10 @@ private:
  const VariableValue & _some_var_y;
  const VariableValue & _some_var_z;
 
+  ///Tabulated normal flux replacing the coupled vector, if given
+  const PressureHistory * _history;
+  unsigned int _segment;
+
 
 };
 
@@ -28,6 +28,7 @@ class MonopoleDirac : public DiracKernel
 public:
   MonopoleDirac(const InputParameters & parameters);
   
+  virtual void initialSetup() override;
   virtual void addPoints() override;
   virtual Real computeQpResidual() override;
 
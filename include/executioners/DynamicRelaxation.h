@@ -0,0 +1,76 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef DYNAMICRELAXATION_H
+#define DYNAMICRELAXATION_H
+
+#include "Transient.h"
+
+#include <petscsnes.h>
+
+class DynamicRelaxation;
+
+template<>
+InputParameters validParams<DynamicRelaxation>();
+
+/**
+ * Transient executioner for quasi-static fracture that brings every load step
+ * to static equilibrium by dynamic relaxation instead of Newton. The nonlinear
+ * solver is replaced by a shell SNES, so time stepping, cutbacks and time
+ * steppers work unchanged, and every iteration costs one residual evaluation
+ * of the existing kernels. No Jacobian is assembled.
+ *
+ * The pseudo-dynamic system M v' + c M v + R(x) = 0 is integrated by central
+ * differences with a unit pseudo time step (Underwood, 1983).
+ *  - The lumped fictitious mass is the Gerschgorin bound m_i = mass_factor/4 sum_j |K_ij|.
+ *    The dofs are colored so that no two dofs of a color share an element, then
+ *    K z for the unit vector z of every color, obtained by differencing the residual,
+ *    holds one K_ij per row. It is doubled and the step restarted whenever the
+ *    residual diverges.
+ *  - viscous damping adapts c = 2 omega to the lowest mode, estimated by the
+ *    Rayleigh quotient of the last increment.
+ *  - kinetic damping (Papadrakakis) integrates undamped and resets the
+ *    velocities whenever the kinetic energy passes a peak.
+ * The step has converged once |R| <= max(dr_abs_tol, dr_rel_tol |R_0|).
+ */
+class DynamicRelaxation : public Transient
+{
+public:
+  DynamicRelaxation(const InputParameters & parameters);
+
+  virtual void init() override;
+
+protected:
+  enum DampingType
+  {
+    Viscous,
+    Kinetic
+  };
+
+  /// Solve callback of the shell SNES
+  static PetscErrorCode relaxCallback(SNES snes, Vec x);
+
+  /// Relaxes x to equilibrium, returns the reason reported to the SNES
+  virtual SNESConvergedReason relax(SNES snes, Vec x);
+
+  /// Distance 2 coloring of the nonlinear dofs over the element couplings
+  virtual ISColoring colorDofs();
+
+  /// Computes the fictitious mass m at x, r is the residual at x
+  virtual void computeMass(SNES snes, Vec x, Vec r, Real mass_factor, Vec m);
+
+  const unsigned int _dr_max_its;
+  const Real _dr_rel_tol;
+  const Real _dr_abs_tol;
+  const DampingType _damping;
+  const Real _mass_factor;
+  const unsigned int _mass_update_its;
+  const Real _divergence_factor;
+  const unsigned int _max_restarts;
+  const Real _probe_size;
+};
+
+#endif //DYNAMICRELAXATION_H
@@ -0,0 +1,76 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef MONTECARLOTRANSIENT_H
+#define MONTECARLOTRANSIENT_H
+
+#include "Transient.h"
+
+class MonteCarloTransient;
+class MooseApp;
+
+template<>
+InputParameters validParams<MonteCarloTransient>();
+
+/**
+ * Runs several realizations of a transient fracture problem back to back in one
+ * process. The mesh, the DofMap, the matrix sparsity and the solver objects are
+ * set up once. Between realizations only the time, the initial conditions, the
+ * stateful material properties and the initial user objects are reset.
+ *
+ * Random fields of materials that use EnsembleRandom::shift differ between
+ * realizations, and materials may take per realization scalar overrides through
+ * scalar(). Realization 0 reproduces a plain Transient run.
+ * Peak load, failure time and crack length of each realization are written to
+ * one CSV table. The file outputs (Exodus, CSV, ...) only hold realization 0,
+ * later realizations only write to the console and the summary table.
+ */
+class MonteCarloTransient : public Transient
+{
+public:
+  MonteCarloTransient(const InputParameters & parameters);
+
+  virtual void execute() override;
+  virtual void endStep(Real input_time = -1.0) override;
+
+  /// Realization currently run by the executioner of app, 0 for other executioners
+  static unsigned int realization(MooseApp & app);
+
+  /**
+   * Value of the scalar override name for the current realization, or
+   * default_value if the executioner of app does not override it
+   */
+  static Real scalar(MooseApp & app, const std::string & name, Real default_value);
+
+protected:
+  /// Brings the problem back to the initial state for the next realization
+  virtual void resetRealization();
+  virtual void writeSummary();
+
+  const unsigned int _num_realizations;
+  const std::vector<std::string> _scalar_names;
+  const std::vector<Real> _scalar_values;
+
+  const PostprocessorName _load_pp;
+  const PostprocessorName _crack_length_pp;
+  const bool _has_crack_length;
+  /// The realization failed once the load dropped below this fraction of the peak load
+  const Real _failure_ratio;
+  const FileName _summary_file;
+
+  unsigned int _realization;
+
+  /// Metrics of the running realization
+  Real _peak_load;
+  Real _peak_time;
+  Real _failure_time;
+  Real _crack_length;
+
+  /// One row per realization: peak load, peak time, failure time, crack length
+  std::vector<std::vector<Real> > _summary;
+};
+
+#endif //MONTECARLOTRANSIENT_H
@@ -22,6 +22,7 @@ public:
 
   InertialForceExp(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
   virtual void computeJacobian() override;
 
 
@@ -39,6 +40,8 @@ private:
   const VariableValue & _u_nodal_old;
   const VariableValue & _u_nodal_older;
 
+  /// Nodal or qp rates handed to the specialized element kernels
+  std::vector<Real> _rate;
   };
 
 #endif //INERTIALFORCEEXP_H
@@ -20,7 +20,7 @@
 class SourceMonopole;
 
 template<>
-InputParameters validParams<Kernel>();
+InputParameters validParams<SourceMonopole>();
 
 
 class SourceMonopole : public Kernel
@@ -28,7 +28,7 @@ class SourceMonopole : public Kernel
 public:
   SourceMonopole(const InputParameters & parameters);
 
-  std::vector<Real> _coord;
+  Point _coord;
   Real _size;
   Real _upcoeff;
   Real _downcoeff;
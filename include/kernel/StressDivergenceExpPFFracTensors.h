@@ -11,6 +11,8 @@
 #include "Material.h"
 #include "DerivativeMaterialInterface.h"
 
+class LocalTimeStepLevels;
+
 /**
  * This class computes the off-diagonal Jacobian component of stress divergence residual system
  * Contribution from damage order parameter c
@@ -29,6 +31,7 @@ public:
   StressDivergenceExpPFFracTensors(const InputParameters & parameters);
 
 protected:
+  virtual void computeResidual() override;
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override; 
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
@@ -37,6 +40,17 @@ protected:
   const bool _c_coupled;
   const unsigned int _c_var;
   const MaterialProperty<RankTwoTensor> & _d_stress_dc;
+
+  /// Hourglass stiffness coefficient for one point integration (0 disables hourglass control)
+  const Real _hourglass_coefficient;
+  /// Undamaged elasticity tensor for the hourglass stiffness
+  const MaterialProperty<RankFourTensor> * _elasticity_tensor;
+  /// Old damage degradation of the hourglass stiffness, consistent with the old displacements
+  const MaterialProperty<Real> * _degradation;
+  std::vector<const VariableValue *> _disp_nodal_old;
+
+  /// Multi-rate levels, the force of a level L element is applied 2^L times every 2^L steps
+  const LocalTimeStepLevels * _time_step_levels;
 };
 
 #endif //STRESSDIVERGENCEEXPPFFRACTENSORS_H
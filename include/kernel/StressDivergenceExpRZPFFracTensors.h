@@ -0,0 +1,35 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef STRESSDIVERGENCEEXPRZPFFRACTENSORS_H
+#define STRESSDIVERGENCEEXPRZPFFRACTENSORS_H
+
+#include "StressDivergenceExpPFFracTensors.h"
+
+/**
+ * Axisymmetric (RZ) version of StressDivergenceExpPFFracTensors. The residual is
+ * computed from the old damaged stress of the material, which has to come from an
+ * axisymmetric strain calculator, and contains the hoop stress term for the
+ * radial component.
+ */
+
+class StressDivergenceExpRZPFFracTensors;
+
+template<>
+InputParameters validParams<StressDivergenceExpRZPFFracTensors>();
+
+class StressDivergenceExpRZPFFracTensors : public StressDivergenceExpPFFracTensors
+{
+public:
+  StressDivergenceExpRZPFFracTensors(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+};
+
+#endif //STRESSDIVERGENCEEXPRZPFFRACTENSORS_H
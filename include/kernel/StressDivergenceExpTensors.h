@@ -10,6 +10,9 @@
 #include "StressDivergenceTensors.h"
 #include "Material.h"
 #include "DerivativeMaterialInterface.h"
+#include "ElasticStiffnessCache.h"
+
+class LocalTimeStepLevels;
 
 /**
  * This class computes the off-diagonal Jacobian component of stress divergence residual system
@@ -32,6 +35,27 @@ protected:
 
   const MaterialProperty<RankTwoTensor> & _stress_old;
 
+  /// Use per-element stiffness blocks in undamaged elements instead of the old stress
+  const bool _cache_stiffness;
+  const MaterialProperty<RankFourTensor> * _elasticity_tensor;
+  const bool _c_coupled;
+  const VariableValue & _c_old;
+  /// Largest old damage at which an element is still treated as linear elastic
+  const Real _damage_tolerance;
+  std::vector<const VariableValue *> _disp_nodal_old;
+  ElasticStiffnessCache _stiffness_cache;
+
+  /// Hourglass stiffness coefficient for one point integration (0 disables hourglass control)
+  const Real _hourglass_coefficient;
+  /// Old damage degradation of the hourglass stiffness, consistent with the old displacements
+  const MaterialProperty<Real> * _degradation;
+
+  /// Multi-rate levels, the force of a level L element is applied 2^L times every 2^L steps
+  const LocalTimeStepLevels * _time_step_levels;
+
+  virtual void computeResidual() override;
+  /// Residual from the cached element stiffness, returns false for damaged elements
+  virtual bool computeCachedResidual();
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
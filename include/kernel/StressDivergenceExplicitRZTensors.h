@@ -0,0 +1,35 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef STRESSDIVERGENCEEXPLICITRZTENSORS_H
+#define STRESSDIVERGENCEEXPLICITRZTENSORS_H
+
+#include "StressDivergenceExplicitTensors.h"
+
+/**
+ * Axisymmetric (RZ) version of StressDivergenceExplicitTensors. The stress is
+ * computed from the old displacements including the hoop strain u_r/r, and the
+ * radial residual contains the hoop stress term. Component 0 is the radial
+ * and component 1 the axial direction.
+ */
+
+class StressDivergenceExplicitRZTensors;
+
+template<>
+InputParameters validParams<StressDivergenceExplicitRZTensors>();
+
+class StressDivergenceExplicitRZTensors : public StressDivergenceExplicitTensors
+{
+public:
+  StressDivergenceExplicitRZTensors(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+};
+
+#endif //STRESSDIVERGENCEEXPLICITRZTENSORS_H
@@ -10,6 +10,9 @@
 #include "StressDivergenceTensors.h"
 #include "Material.h"
 #include "Kernel.h"
+#include "ElasticStiffnessCache.h"
+
+class LocalTimeStepLevels;
 
 /**
  * This class computes the off-diagonal Jacobian component of stress divergence residual system
@@ -30,6 +33,21 @@ public:
 
 protected:
 
+  virtual void computeResidual() override;
+
+  /// Residual from the cached element stiffness
+  virtual void computeCachedResidual();
+
+  /**
+   * Residual from the compile time specialized element kernels for QUAD4 and HEX8,
+   * returns false if the current element has no specialization
+   */
+  virtual bool computeSpecializedResidual();
+
+  /// Assembles the stiffness rows of this component for the current element into ke
+  virtual void computeStiffnessBlock(Real * ke);
+
+
   unsigned int _ndisp;
   std::vector<const VariableValue *> _disp;
   std::vector<const VariableGradient *> _grad_disp;
@@ -38,6 +56,22 @@ protected:
   const MaterialProperty<RankFourTensor> & _elasticity_tensor;
   unsigned int _component;
 
+  /// Use per-element stiffness blocks instead of quadrature for the residual
+  const bool _cache_stiffness;
+  std::vector<const VariableValue *> _disp_nodal_old;
+  ElasticStiffnessCache _stiffness_cache;
+
+  /// Hourglass stiffness coefficient for one point integration (0 disables hourglass control)
+  const Real _hourglass_coefficient;
+  /// Old damage degradation of the hourglass stiffness, consistent with the old displacements
+  const MaterialProperty<Real> * _degradation;
+
+  /// Use the specialized element kernels where available (Cartesian coordinates only)
+  const bool _specialized_kernels;
+
+  /// Multi-rate levels, the force of a level L element is applied 2^L times every 2^L steps
+  const LocalTimeStepLevels * _time_step_levels;
+
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
@@ -22,6 +22,7 @@ public:
 
   TimeDerivativeExp(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
   virtual void computeJacobian() override;
 
 
@@ -37,6 +38,8 @@ private:
   const VariableValue & _u_nodal;
   const VariableValue & _u_nodal_old;
 
+  /// Nodal or qp rates handed to the specialized element kernels
+  std::vector<Real> _rate;
   };
 
 #endif //TIMEDERIVATIVEEXP_H
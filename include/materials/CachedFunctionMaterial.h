@@ -0,0 +1,44 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef CACHEDFUNCTIONMATERIAL_H
+#define CACHEDFUNCTIONMATERIAL_H
+
+#include "Material.h"
+#include "Function.h"
+
+class CachedFunctionMaterial;
+
+template<>
+InputParameters validParams<CachedFunctionMaterial>();
+
+/**
+ * Material property from a function of position only, e.g. a gc or stiffness
+ * map of a microstructure. The function is evaluated once per qp and kept as a
+ * stateful property together with the point it was evaluated at. It is only
+ * re-evaluated when the qp moves, i.e. for elements created or prolongated by
+ * adaptivity and on displaced meshes.
+ */
+class CachedFunctionMaterial : public Material
+{
+public:
+  CachedFunctionMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties();
+  virtual void computeQpProperties();
+
+  Function & _function;
+
+  MaterialProperty<Real> & _prop;
+  MaterialProperty<Real> & _prop_old;
+
+  ///Points the cached values were evaluated at
+  MaterialProperty<Point> & _point;
+  MaterialProperty<Point> & _point_old;
+};
+
+#endif //CACHEDFUNCTIONMATERIAL_H
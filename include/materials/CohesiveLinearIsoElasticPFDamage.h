@@ -10,6 +10,8 @@
 #include "ComputeStressBase.h"
 #include "Function.h"
 
+#include <unordered_map>
+
 /**
  * Phase-field fracture
  * This class computes the energy contribution to damage growth
@@ -26,7 +28,28 @@ protected:
   virtual void computeQpStress();
   virtual void updateVar();
   virtual void updateJacobian();
+  /// Miehe spectral split of the strain, needs an eigen-decomposition per qp
+  void spectralSplit(Real lambda, Real mu, RankTwoTensor & stress0pos, RankTwoTensor & stress0neg, Real & G0_trial);
+
+  /**
+   * Lazy evaluation: restores the stored residual outputs of the current qp if its
+   * inputs match the previous evaluation. Returns false if the qp has to be recomputed.
+   * With the default tolerances of 0 this only skips exactly repeated evaluations,
+   * e.g. the residual after the Jacobian of the same iterate or the aux and
+   * postprocessor evaluations at timestep_end. PJFNK finite difference evaluations
+   * perturb all dofs, so they change the strain of every qp and are not reused.
+   */
+  bool restoreQpState();
+  void storeQpState();
 
+  /// Split of the elastic energy into the part driving damage and the undegraded part
+  enum SplitType
+  {
+    Spectral,
+    VolumetricDeviatoric
+  };
+
+  const SplitType _split;
   const VariableValue & _c;
   /// Small number to avoid non-positive definiteness at or near complete damage
   Real _kdamage;
@@ -45,6 +68,37 @@ protected:
   MaterialProperty<Real> & _G0_pos_old;
   MaterialProperty<RankTwoTensor> & _dstress_dc;
   MaterialProperty<RankTwoTensor> & _dG0_pos_dstrain;
+  /// Degradation of the tensile stiffness, used to scale hourglass control of one point integrated elements
+  MaterialProperty<Real> & _degradation;
+
+  /// Inputs and outputs of the last evaluation of a qp, used by the lazy evaluation mode
+  struct QpState
+  {
+    QpState() : _valid(false) {}
+
+    bool _valid;
+    RankTwoTensor _strain;
+    Real _c;
+    Real _G0_pos_old;
+    Real _gc;
+    Real _Emod;
+    Real _sigmac;
+    Real _lambda;
+    Real _mu;
+
+    RankTwoTensor _stress;
+    Real _G0_pos;
+    RankTwoTensor _dG0_pos_dstrain;
+    RankTwoTensor _dstress_dc;
+    Real _degradation;
+  };
+
+  bool _lazy_evaluation;
+  ///Absolute tolerances on the change of strain (L2 norm) and damage below which a qp is not recomputed
+  Real _lazy_strain_tol;
+  Real _lazy_damage_tol;
+  std::unordered_map<dof_id_type, std::vector<QpState> > _qp_states;
+  QpState * _qp_state;
 
   std::vector<RankTwoTensor> _etens;
   std::vector<Real> _epos;
@@ -0,0 +1,33 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef COMPUTESCALEDELASTICITYTENSOR_H
+#define COMPUTESCALEDELASTICITYTENSOR_H
+
+#include "ComputeElasticityTensor.h"
+
+class ComputeScaledElasticityTensor;
+
+template<>
+InputParameters validParams<ComputeScaledElasticityTensor>();
+
+/**
+ * ComputeElasticityTensor scaled by a material property instead of the
+ * elasticity_tensor_prefactor function, so a spatial prefactor can be served
+ * from a CachedFunctionMaterial rather than evaluated at every qp
+ */
+class ComputeScaledElasticityTensor : public ComputeElasticityTensor
+{
+public:
+  ComputeScaledElasticityTensor(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpElasticityTensor();
+
+  const MaterialProperty<Real> & _prefactor;
+};
+
+#endif //COMPUTESCALEDELASTICITYTENSOR_H
@@ -26,7 +26,17 @@ protected:
   virtual void computeQpStress();
   virtual void updateVar();
   virtual void updateJacobian();
+  /// Miehe spectral split of the strain, needs an eigen-decomposition per qp
+  void spectralSplit(Real lambda, Real mu, RankTwoTensor & stress0pos, RankTwoTensor & stress0neg, Real & G0_trial);
 
+  /// Split of the elastic energy into the part driving damage and the undegraded part
+  enum SplitType
+  {
+    Spectral,
+    VolumetricDeviatoric
+  };
+
+  const SplitType _split;
   const VariableValue & _c;
   /// Small number to avoid non-positive definiteness at or near complete damage
   Real _kdamage;
@@ -35,6 +45,8 @@ protected:
   MaterialProperty<Real> & _G0_pos_old;
   MaterialProperty<RankTwoTensor> & _dstress_dc;
   MaterialProperty<RankTwoTensor> & _dG0_pos_dstrain;
+  /// Degradation of the tensile stiffness, used to scale hourglass control of one point integrated elements
+  MaterialProperty<Real> & _degradation;
 
   std::vector<RankTwoTensor> _etens;
   std::vector<Real> _epos;
@@ -27,11 +27,13 @@ public:
   PFFracRandomBulkRateMaterial(const InputParameters & parameters);
 
 protected:
+  /// Picks up the gc and pC of the current Monte Carlo realization
+  virtual void initialSetup();
   virtual void initQpStatefulProperties();
   virtual void computeQpProperties();
   /**
-   * This function obtains the value of gc
-   * Must be overidden by the user for heterogeneous gc
+   * This function obtains the unperturbed value of gc, either _gc or the
+   * function of position. It is only called when the stateful gc is initialized.
    */
   virtual void getProp();
 
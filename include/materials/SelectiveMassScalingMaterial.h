@@ -0,0 +1,43 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SELECTIVEMASSSCALINGMATERIAL_H
+#define SELECTIVEMASSSCALINGMATERIAL_H
+
+#include "Material.h"
+#include "RankFourTensor.h"
+
+class SelectiveMassScalingMaterial;
+
+template<>
+InputParameters validParams<SelectiveMassScalingMaterial>();
+
+/**
+ * Selective mass scaling for explicit quasi-static runs. The stable step of an
+ * element is h_min / c with the dilatational wave speed c = sqrt((lambda + 2 mu) / rho).
+ * Elements whose stable step is below target_dt get the density that makes
+ * it exactly target_dt, all other elements keep their density.
+ * scaled_density is meant to be used as the density of InertialForceExp with
+ * use_lumped_mass = true, added_density reports the added mass
+ * (ElementIntegralMaterialProperty, AddedMassKineticEnergyRatio).
+ */
+class SelectiveMassScalingMaterial : public Material
+{
+public:
+  SelectiveMassScalingMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  const MaterialProperty<Real> & _density;
+  const MaterialProperty<RankFourTensor> & _elasticity_tensor;
+  const Real _target_dt;
+
+  MaterialProperty<Real> & _scaled_density;
+  MaterialProperty<Real> & _added_density;
+};
+
+#endif //SELECTIVEMASSSCALINGMATERIAL_H
@@ -0,0 +1,40 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef CACHEDFILEMESH_H
+#define CACHEDFILEMESH_H
+
+#include "FileMesh.h"
+
+class CachedFileMesh;
+
+template<>
+InputParameters validParams<CachedFileMesh>();
+
+/**
+ * FileMesh that stores the uniformly refined and partitioned mesh in a binary
+ * checkpoint cache. The cache is keyed by the input file (path, size and
+ * modification time), the refinement level, the number of ranks and the mesh
+ * type, so later runs with the same setup skip reading, refining and
+ * partitioning. With a distributed mesh every rank reads only its own piece.
+ */
+class CachedFileMesh : public FileMesh
+{
+public:
+  CachedFileMesh(const InputParameters & parameters);
+  CachedFileMesh(const CachedFileMesh & other_mesh);
+
+  virtual MooseMesh & clone() const override;
+  virtual void buildMesh() override;
+
+protected:
+  /// Name of the cache for the current input mesh and run setup
+  std::string cacheFileName();
+
+  const std::string _cache_directory;
+};
+
+#endif //CACHEDFILEMESH_H
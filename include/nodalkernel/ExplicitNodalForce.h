@@ -0,0 +1,32 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EXPLICITNODALFORCE_H
+#define EXPLICITNODALFORCE_H
+
+#include "NodalKernel.h"
+
+class ExplicitNodalForce;
+
+template<>
+InputParameters validParams<ExplicitNodalForce>();
+
+/**
+ * Adds a nodal internal force, e.g. assembled by ExplicitForceAssembler, to the
+ * residual. The force is explicit, so it has no Jacobian.
+ */
+class ExplicitNodalForce : public NodalKernel
+{
+public:
+  ExplicitNodalForce(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+
+  const VariableValue & _force;
+};
+
+#endif //EXPLICITNODALFORCE_H
@@ -0,0 +1,73 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ASYNCCHECKPOINT_H
+#define ASYNCCHECKPOINT_H
+
+#include "FileOutput.h"
+
+#include <deque>
+#include <memory>
+#include <thread>
+
+class AsyncCheckpoint;
+class SystemBase;
+class MaterialPropertyStorage;
+class MooseMesh;
+
+template<>
+InputParameters validParams<AsyncCheckpoint>();
+
+/**
+ * Checkpoint of the solution vectors and the stateful material properties that
+ * does not block the time stepping on disk I/O. The state owned by each rank is
+ * copied into an in-memory buffer and a background thread writes it to one binary
+ * file per rank. Rank 0 writes a small index for a checkpoint once every rank has
+ * finished writing it, so an index always refers to complete files.
+ * The checkpoint is read back with the AsyncCheckpointRestart user object.
+ */
+class AsyncCheckpoint : public FileOutput
+{
+public:
+  AsyncCheckpoint(const InputParameters & parameters);
+  virtual ~AsyncCheckpoint();
+
+  virtual std::string filename() override;
+
+  ///Binary layout shared with AsyncCheckpointRestart
+  static const unsigned int VERSION = 1;
+  static void storeSystem(std::ostream & stream, SystemBase & sys);
+  static void loadSystem(std::istream & stream, SystemBase & sys);
+  static void storeMaterials(std::ostream & stream, MaterialPropertyStorage & storage);
+  static void loadMaterials(std::istream & stream, MaterialPropertyStorage & storage, MooseMesh & mesh);
+
+  /// Name of the file written by the given rank for the checkpoint with the given index name
+  static std::string rankFileName(const std::string & index, processor_id_type rank);
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// Waits for the background write and lets rank 0 write the index of the pending checkpoint
+  void commitPending();
+
+  /// Number of checkpoints to keep on disk
+  const unsigned int _num_files;
+
+  std::unique_ptr<std::thread> _writer;
+  bool _write_failed;
+
+  /// Checkpoint written by the background thread, not yet recorded in an index
+  bool _pending;
+  std::string _pending_index;
+  Real _pending_time;
+  int _pending_t_step;
+  std::size_t _pending_size;
+
+  /// Committed checkpoints, oldest first
+  std::deque<std::string> _committed;
+};
+
+#endif //ASYNCCHECKPOINT_H
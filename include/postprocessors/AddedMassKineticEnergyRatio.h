@@ -0,0 +1,41 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ADDEDMASSKINETICENERGYRATIO_H
+#define ADDEDMASSKINETICENERGYRATIO_H
+
+#include "ElementPostprocessor.h"
+
+class AddedMassKineticEnergyRatio;
+
+template<>
+InputParameters validParams<AddedMassKineticEnergyRatio>();
+
+/**
+ * Share of the kinetic energy carried by the mass added by
+ * SelectiveMassScalingMaterial, int added_density v.v / int scaled_density v.v.
+ * It has to stay small for the scaled run to remain quasi-static.
+ */
+class AddedMassKineticEnergyRatio : public ElementPostprocessor
+{
+public:
+  AddedMassKineticEnergyRatio(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  std::vector<const VariableValue *> _vel;
+  const MaterialProperty<Real> & _scaled_density;
+  const MaterialProperty<Real> & _added_density;
+
+  Real _added_energy;
+  Real _total_energy;
+};
+
+#endif //ADDEDMASSKINETICENERGYRATIO_H
@@ -0,0 +1,39 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef BOUNDARYREACTIONFORCE_H
+#define BOUNDARYREACTIONFORCE_H
+
+#include "SidePostprocessor.h"
+#include "RankTwoTensor.h"
+
+class BoundaryReactionForce;
+
+template<>
+InputParameters validParams<BoundaryReactionForce>();
+
+/**
+ * Reaction force on a boundary, the integral of the traction (stress . n)_component
+ * over its sides. Only the sides of the boundary are visited, so unlike
+ * save_in and NodalSum it needs no mesh wide auxiliary residual copies.
+ */
+class BoundaryReactionForce : public SidePostprocessor
+{
+public:
+  BoundaryReactionForce(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const MaterialProperty<RankTwoTensor> & _stress;
+  const unsigned int _component;
+  Real _value;
+};
+
+#endif //BOUNDARYREACTIONFORCE_H
@@ -0,0 +1,38 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef BOUNDARYREACTIONFORCEVECTOR_H
+#define BOUNDARYREACTIONFORCEVECTOR_H
+
+#include "SideVectorPostprocessor.h"
+#include "RankTwoTensor.h"
+
+class BoundaryReactionForceVector;
+
+template<>
+InputParameters validParams<BoundaryReactionForceVector>();
+
+/**
+ * All components of the reaction force on a boundary in one pass over its
+ * sides, written to the vector reaction (see BoundaryReactionForce)
+ */
+class BoundaryReactionForceVector : public SideVectorPostprocessor
+{
+public:
+  BoundaryReactionForceVector(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const MaterialProperty<RankTwoTensor> & _stress;
+  const unsigned int _ndisp;
+  VectorPostprocessorValue & _reaction;
+};
+
+#endif //BOUNDARYREACTIONFORCEVECTOR_H
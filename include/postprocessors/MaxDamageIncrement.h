@@ -0,0 +1,35 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef MAXDAMAGEINCREMENT_H
+#define MAXDAMAGEINCREMENT_H
+
+#include "NodalVariablePostprocessor.h"
+
+class MaxDamageIncrement;
+
+template<>
+InputParameters validParams<MaxDamageIncrement>();
+
+/**
+ * Largest nodal change of the damage variable over the last time step
+ */
+class MaxDamageIncrement : public NodalVariablePostprocessor
+{
+public:
+  MaxDamageIncrement(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const VariableValue & _u_old;
+  Real _value;
+};
+
+#endif //MAXDAMAGEINCREMENT_H
@@ -0,0 +1,52 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef RANKMEMORY_H
+#define RANKMEMORY_H
+
+#include "GeneralPostprocessor.h"
+
+class RankMemory;
+
+template<>
+InputParameters validParams<RankMemory>();
+
+/**
+ * Resident memory of the ranks in MB, reduced over the ranks by value_type.
+ * memory_type = current samples the resident set when the postprocessor runs, so
+ * transients of the setup (e.g. a mesh that is built serially and then distributed)
+ * are not counted. memory_type = peak is the high-water mark over the process lifetime.
+ * Comparing current max_over_ranks for several rank counts shows whether the memory
+ * of a rank falls as ranks are added, i.e. whether the mesh is really distributed.
+ */
+class RankMemory : public GeneralPostprocessor
+{
+public:
+  RankMemory(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual Real getValue() override;
+
+protected:
+  enum ValueType
+  {
+    MaxOverRanks,
+    MinOverRanks,
+    Average
+  };
+
+  /// Current resident memory of this rank in MB
+  Real currentMemory();
+  /// Peak resident memory of this rank in MB
+  Real peakMemory();
+
+  const bool _peak;
+  const ValueType _value_type;
+  Real _value;
+};
+
+#endif //RANKMEMORY_H
@@ -0,0 +1,55 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef DAMAGEPREDICTOR_H
+#define DAMAGEPREDICTOR_H
+
+#include "Predictor.h"
+
+class DamagePredictor;
+
+template<>
+InputParameters validParams<DamagePredictor>();
+
+/**
+ * Predictor for implicit phase-field fracture steps. The initial guess is
+ * extrapolated in time from the last two (order = 1) or three (order = 2)
+ * converged states, using the actual step sizes. The damage is then clamped to
+ * [c_old, 1], so the guess respects irreversibility. If the residual of the
+ * prediction is larger than the one of the previous solution times
+ * fallback_factor, the step starts from the previous solution as without predictor.
+ */
+class DamagePredictor : public Predictor
+{
+public:
+  DamagePredictor(const InputParameters & parameters);
+
+  virtual void apply(NumericVector<Number> & sln) override;
+
+protected:
+  /// Updates the stored third state once the time steps advanced
+  void shiftHistory(Real older_time);
+
+  Real residualNorm(NumericVector<Number> & sln);
+
+  const unsigned int _order;
+  const NonlinearVariableName & _damage_name;
+  const Real _fallback_factor;
+
+  NumericVector<Number> & _backup;
+  NumericVector<Number> & _residual;
+  /// Solution before the older one, available once the older solution changed once
+  NumericVector<Number> & _oldest;
+  /// Older solution seen by the last application, becomes _oldest when the steps advance
+  NumericVector<Number> & _candidate;
+
+  Real & _oldest_time;
+  Real & _candidate_time;
+  bool & _has_oldest;
+  bool & _has_candidate;
+};
+
+#endif //DAMAGEPREDICTOR_H
@@ -0,0 +1,63 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef DAMAGECONTROLLEDTIMESTEPPER_H
+#define DAMAGECONTROLLEDTIMESTEPPER_H
+
+#include "TimeStepper.h"
+#include "PostprocessorInterface.h"
+
+class DamageControlledTimeStepper;
+
+template<>
+InputParameters validParams<DamageControlledTimeStepper>();
+
+/**
+ * Time stepper for quasi-static phase-field fracture. The next step is the
+ * current one scaled by the smallest of
+ *  - growth_factor, so the step recovers gradually after a crack burst,
+ *  - target_damage_increment over the max damage increment of the last step,
+ *  - the factor that brings the driving energy at most a fraction
+ *    energy_approach of the way to energy_threshold (e.g. the cohesive onset
+ *    energy sigmac^2/2E), as long as the threshold is not reached. Once the
+ *    rest is below energy_snap of the threshold the step aims at the threshold
+ *    itself, and this factor is never below min_approach_factor, so the onset
+ *    is crossed after a few steps instead of at dt_min,
+ *  - optimal_iterations over the nonlinear iterations of the last step.
+ * Failed solves are cut back by cutback_factor.
+ */
+class DamageControlledTimeStepper : public TimeStepper, public PostprocessorInterface
+{
+public:
+  DamageControlledTimeStepper(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+  virtual Real computeFailedDT() override;
+
+  const Real _initial_dt;
+  const Real _dt_min;
+  const Real _dt_max;
+
+  const PostprocessorValue & _damage_increment;
+  const Real _target_damage_increment;
+
+  const PostprocessorValue * _energy;
+  const Real _energy_threshold;
+  const Real _energy_approach;
+  const Real _energy_snap;
+  const Real _min_approach_factor;
+
+  const unsigned int _optimal_iterations;
+  const Real _growth_factor;
+  const Real _cutback_factor;
+
+  /// Driving energy at the end of the previous step
+  Real & _energy_old;
+};
+
+#endif //DAMAGECONTROLLEDTIMESTEPPER_H
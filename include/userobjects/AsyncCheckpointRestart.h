@@ -0,0 +1,37 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ASYNCCHECKPOINTRESTART_H
+#define ASYNCCHECKPOINTRESTART_H
+
+#include "GeneralUserObject.h"
+
+class AsyncCheckpointRestart;
+
+template<>
+InputParameters validParams<AsyncCheckpointRestart>();
+
+/**
+ * Restores the time, the solution vectors and the stateful material properties
+ * from a checkpoint written by AsyncCheckpoint. Every rank reads its own file,
+ * so the run has to use the same mesh and number of ranks as the checkpointed one.
+ */
+class AsyncCheckpointRestart : public GeneralUserObject
+{
+public:
+  AsyncCheckpointRestart(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Index file written by AsyncCheckpoint
+  const FileName & _file;
+  bool _restored;
+};
+
+#endif //ASYNCCHECKPOINTRESTART_H
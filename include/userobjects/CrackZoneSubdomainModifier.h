@@ -0,0 +1,65 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef CRACKZONESUBDOMAINMODIFIER_H
+#define CRACKZONESUBDOMAINMODIFIER_H
+
+#include "GeneralUserObject.h"
+
+class CrackZoneSubdomainModifier;
+class MooseVariable;
+
+template<>
+InputParameters validParams<CrackZoneSubdomainModifier>();
+
+/**
+ * Moves the crack zone into an implicitly integrated subdomain for element
+ * partitioned implicit-explicit (IMEX) time integration. Elements of
+ * explicit_block whose nodal damage exceeds damage_threshold are moved to
+ * implicit_block, together with buffer_layers layers of face neighbors, so the
+ * zone stays ahead of the crack tip. The move is irreversible.
+ *
+ * The inertia kernel (InertialForceExp, lumped) and the damage kernels
+ * (PFFracBulkRateModify, ...) act on both blocks, the explicit stiffness kernels
+ * (StressDivergenceExplicitTensors, old displacements) are restricted to
+ * explicit_block and the implicit stiffness kernels (StressDivergenceTensors, ...)
+ * to implicit_block. The damage must evolve on both blocks, otherwise the zone
+ * only grows once the damage reaches one of its nodes. The interface nodes sum
+ * both contributions, so they are coupled without extra terms, and only the
+ * displacement dofs of implicit elements carry off-diagonal stiffness entries.
+ * The stable time step is the one of the explicit block. Materials with
+ * stateful properties must be defined on both blocks so moved elements keep
+ * their history.
+ *
+ * Both blocks are advanced by one nonlinear solve over all dofs. The explicit
+ * kernels are evaluated in every nonlinear iteration and the Jacobian and the
+ * preconditioner include the explicit block, so the far field costs less than an
+ * implicit one but more than a pure explicit update.
+ */
+class CrackZoneSubdomainModifier : public GeneralUserObject
+{
+public:
+  CrackZoneSubdomainModifier(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Local explicit elements with a damaged node
+  std::vector<dof_id_type> damagedElements();
+
+  /// Local explicit elements outside zone with a face neighbor in zone
+  std::vector<dof_id_type> neighborElements(const std::set<dof_id_type> & zone);
+
+  MooseVariable & _damage;
+  const Real _damage_threshold;
+  const SubdomainID _explicit_id;
+  const SubdomainID _implicit_id;
+  const unsigned int _buffer_layers;
+};
+
+#endif //CRACKZONESUBDOMAINMODIFIER_H
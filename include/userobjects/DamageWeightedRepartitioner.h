@@ -0,0 +1,75 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef DAMAGEWEIGHTEDREPARTITIONER_H
+#define DAMAGEWEIGHTEDREPARTITIONER_H
+
+#include "GeneralUserObject.h"
+
+class DamageWeightedRepartitioner;
+class MooseVariable;
+class MaterialPropertyStorage;
+
+template<>
+InputParameters validParams<DamageWeightedRepartitioner>();
+
+/**
+ * Repartitions the mesh with per element cost weights once the load imbalance
+ * between the ranks exceeds a threshold. Elements in and ahead of the crack do the
+ * eigen split and carry a nonzero damage driving force, so an element costs
+ * damaged_weight once the damage on any of its nodes exceeds damage_threshold,
+ * and 1 otherwise. The stateful material properties of elements that change their
+ * owner are sent to the new owner, the solution vectors are moved by the
+ * reinitialization of the systems.
+ *
+ * A distributed mesh is repartitioned in parallel by ParMETIS (adaptive
+ * repartitioning), which only sees the weights and the dual graph of the local
+ * elements, so no rank needs more than its part of the mesh. A replicated mesh,
+ * or a distributed one when libMesh has no ParMETIS or a rank has no elements,
+ * is partitioned by Metis on every rank with all weights; a distributed mesh is
+ * then serialized for the partitioning.
+ */
+class DamageWeightedRepartitioner : public GeneralUserObject
+{
+public:
+  DamageWeightedRepartitioner(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /// Imbalance (max rank cost over mean rank cost) found by the last execution
+  Real imbalance() const { return _imbalance; }
+
+protected:
+  /// Fills the weights of the active local elements and returns their cost
+  Real computeWeights();
+  virtual void repartition();
+
+  /// Sets the new owners with Metis on the (serialized) whole mesh
+  void serialPartition(std::vector<std::string> & buffers);
+  /// Sets the new owners with ParMETIS on the distributed mesh and redistributes it, false if ParMETIS cannot be used
+  bool parallelPartition(std::vector<std::string> & buffers);
+  /// Packs the history of the former local elements by new owner into buffers and erases the leaving ones
+  void packMoving(std::vector<std::string> & buffers);
+
+  /// Serializes the stateful properties of the given elements
+  void packProperties(MaterialPropertyStorage & storage, const std::vector<const Elem *> & elems, std::ostream & stream);
+  void unpackProperties(MaterialPropertyStorage & storage, std::istream & stream);
+
+  MooseVariable & _damage;
+  const Real _damage_threshold;
+  const Real _damaged_weight;
+  const Real _imbalance_threshold;
+  const std::vector<int> _repartition_steps;
+
+  /// Active local elements and their weights
+  std::vector<const Elem *> _local_elems;
+  std::vector<Real> _local_weights;
+  Real _imbalance;
+};
+
+#endif //DAMAGEWEIGHTEDREPARTITIONER_H
@@ -0,0 +1,84 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ELASTICPHASEJACOBIANLAGGING_H
+#define ELASTICPHASEJACOBIANLAGGING_H
+
+#include "GeneralUserObject.h"
+
+#include <petscsnes.h>
+
+class ElasticPhaseJacobianLagging;
+class MooseVariable;
+
+template<>
+InputParameters validParams<ElasticPhaseJacobianLagging>();
+
+/**
+ * Reuses the Jacobian and preconditioner across Newton iterations and time steps
+ * while the fracture problem is linear elastic. A step counts as elastic if the
+ * damage did not change by more than damage_tol in the previous step and, if
+ * given, the driving energy extrapolated over the coming step stays below
+ * energy_margin * energy_threshold.
+ * During the elastic phase the SNES lags Jacobian and preconditioner
+ * persistently. They are rebuilt once when the phase starts, when dt changes
+ * (the time derivative terms scale with 1/dt), and when the previous step needed
+ * more than max_lagged_its iterations. Within a solve an SNES monitor rebuilds
+ * them when a lagged iteration reduces the residual by less than stall_ratio.
+ * They are rebuilt every iteration again once damage grows, and after a failed
+ * step until a step converges without lagging.
+ */
+class ElasticPhaseJacobianLagging : public GeneralUserObject
+{
+public:
+  ElasticPhaseJacobianLagging(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Largest damage change of the previous step over all ranks
+  Real damageChange();
+
+  /// Driving energy extrapolated to the end of the coming step
+  Real predictedEnergy();
+
+  /// The SNES of the nonlinear system
+  SNES snes();
+
+  /// Sets the lag of Jacobian and preconditioner, -2 rebuilds once and then lags
+  void setLag(int lag, bool persist);
+
+  /// SNES monitor that forces a rebuild when a lagged iteration stalls
+  static PetscErrorCode stallMonitor(SNES snes, PetscInt its, PetscReal fnorm, void * ctx);
+
+  MooseVariable & _damage;
+  const Real _damage_tol;
+  const PostprocessorValue * _energy;
+  const Real _energy_threshold;
+  const Real _energy_margin;
+  const unsigned int _max_lagged_its;
+  const Real _stall_ratio;
+
+  bool _lagging;
+  Real _lagged_dt;
+  /// A solve has followed the last execute
+  bool _solved;
+  /// Lagging is off after a failed step until a step converges without it
+  bool _recovering;
+
+  /// Driving energy of the last two converged steps
+  int _energy_step;
+  Real _energy_last;
+  Real _energy_prev;
+
+  /// Residual norm of the previous nonlinear iteration
+  Real _last_fnorm;
+};
+
+#endif //ELASTICPHASEJACOBIANLAGGING_H
@@ -0,0 +1,90 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EXPLICITFORCEASSEMBLER_H
+#define EXPLICITFORCEASSEMBLER_H
+
+#include "ElementUserObject.h"
+#include "RankFourTensor.h"
+
+#include <unordered_map>
+
+class ExplicitForceAssembler;
+
+template<>
+InputParameters validParams<ExplicitForceAssembler>();
+
+/**
+ * Thread parallel assembly of the small strain elastic internal force of the
+ * explicit path, K u_old, into nodal auxiliary force variables, which the
+ * ExplicitNodalForce nodal kernels add to the residual. It replaces the
+ * StressDivergenceExplicitTensors kernels with cache_stiffness = true.
+ *
+ * The local elements are colored once per mesh change so that no two elements of
+ * a color share a node. Every step the element forces of one color at a time are
+ * computed with Threads::parallel_for and summed into the nodes without locks,
+ * instead of going through the locked residual scatter of the element loop. The
+ * force is computed once per step (at timestep_begin), not in every residual
+ * evaluation.
+ *
+ * The element loop of the user object only rebuilds the stiffness block of an
+ * element when its quadrature summed elasticity tensor (compared by norm) or its
+ * volume changed, so damage that degrades the elasticity tensor is picked up.
+ * Hourglass control, stress splits and multi-rate levels are not supported.
+ */
+class ExplicitForceAssembler : public ElementUserObject
+{
+public:
+  ExplicitForceAssembler(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject &) override {}
+  virtual void finalize() override;
+
+protected:
+  /// Slots, stiffness storage, node lists and coloring of the local elements
+  void buildElementData();
+
+  const unsigned int _ndisp;
+  std::vector<MooseVariable *> _disp;
+  std::vector<MooseVariable *> _force;
+  const MaterialProperty<RankFourTensor> & _elasticity_tensor;
+  const Real _tolerance;
+  const unsigned int _grain_size;
+
+  /// The thread 0 copy, which owns the element data. Every element is visited by one
+  /// thread, so the copies write their slots of it without locks.
+  ExplicitForceAssembler * _master;
+
+  std::unordered_map<dof_id_type, unsigned int> _elem_slot;
+  /// Number of shape functions of every element slot
+  std::vector<unsigned int> _n_test;
+  /// Start of the stiffness block and of the node slots of every element slot
+  std::vector<std::size_t> _stiffness_offset;
+  std::vector<std::size_t> _node_offset;
+  std::vector<unsigned int> _elem_nodes;
+  std::vector<Real> _stiffness;
+  /// Elasticity norm and volume the blocks were assembled with, a zero volume marks a missing block
+  std::vector<Real> _elasticity_norm;
+  std::vector<Real> _volume;
+
+  /// Element slots of every color
+  std::vector<std::vector<unsigned int> > _colors;
+
+  /// Dofs of the node slots, component by component; the owned nodes come first
+  std::vector<dof_id_type> _disp_dofs;
+  std::vector<dof_id_type> _force_dofs;
+  std::size_t _n_owned;
+
+  std::vector<Number> _u;
+  std::vector<Number> _f;
+};
+
+#endif //EXPLICITFORCEASSEMBLER_H
@@ -0,0 +1,114 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EXPLICITNODALUPDATE_H
+#define EXPLICITNODALUPDATE_H
+
+#include "GeneralUserObject.h"
+
+class ExplicitNodalUpdate;
+class LocalTimeStepLevels;
+class MooseVariable;
+
+template<>
+InputParameters validParams<ExplicitNodalUpdate>();
+
+/**
+ * Advances displacement, velocity and acceleration of the explicit dynamics
+ * variables in one pass over the solution vectors, replacing the separate
+ * ExpAccelAux, ExpVelAux and NewmarkDispAux nodal sweeps.
+ *
+ * central_difference: the displacements are the primary variables,
+ *   a = (u - 2 u_old + u_older) / dt^2, v = (u - u_older) / (2 dt)
+ * newmark: the accelerations are the primary variables,
+ *   u = u_old + dt v_old + dt^2/2 ((1 - 2 beta) a_old + 2 beta a)
+ *   v = v_old + dt ((1 - gamma) a_old + gamma a)
+ *
+ * The updated quantities must be nodal auxiliary variables.
+ *
+ * With time_step_levels a node of cycle m receives the force of its elements as
+ * an impulse in the first step of every cycle and moves linearly after it. Its
+ * acceleration is then the impulse divided by m, held for the whole cycle, so
+ * the reported accelerations of coarse and fine nodes mean the same thing.
+ *
+ * In parallel the dofs of nodes ghosted by other ranks are updated first. Their
+ * ghost exchange is posted before the interior dofs are updated and completed
+ * afterwards, so the communication overlaps the interior work.
+ */
+class ExplicitNodalUpdate : public GeneralUserObject
+{
+public:
+  ExplicitNodalUpdate(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  enum SchemeType
+  {
+    CentralDifference,
+    Newmark
+  };
+
+  /**
+   * Collects the locally owned dof indices of every variable. The dofs of nodes
+   * shared with other ranks come first, component by component, then the interior ones.
+   */
+  virtual void buildDofLists();
+  void checkVariables(const std::vector<MooseVariable *> & vars, bool written);
+  void addDofs(const std::vector<const Node *> & nodes, const std::vector<MooseVariable *> & vars, std::vector<dof_id_type> & dofs, std::vector<dof_id_type> * node_ids = NULL);
+  /// Looks up the cycle of the node of every dof
+  void buildCycles();
+
+  /// Reads the input values of the scheme from the solution vectors
+  virtual void gather();
+  /// Updates the entries [begin, end) of the work arrays
+  virtual void update(std::size_t begin, std::size_t end);
+  /// Writes the entries [begin, end) of the updated quantities into the auxiliary solution
+  void scatter(NumericVector<Number> & vec, std::size_t begin, std::size_t end);
+
+  /// Updates the shared dofs, posts their ghost exchange and updates the interior while it is in flight
+  void overlappedUpdate();
+
+  const SchemeType _scheme;
+  const Real _beta;
+  const Real _gamma;
+  /// Smallest chunk of dofs updated by one thread
+  const unsigned int _grain_size;
+
+  std::vector<MooseVariable *> _disp;
+  std::vector<MooseVariable *> _vel;
+  std::vector<MooseVariable *> _accel;
+
+  std::vector<dof_id_type> _disp_dofs;
+  std::vector<dof_id_type> _vel_dofs;
+  std::vector<dof_id_type> _accel_dofs;
+  /// Number of leading entries of the dof lists that belong to nodes ghosted by other ranks
+  std::size_t _n_shared;
+  const bool _overlap;
+
+  const LocalTimeStepLevels * _time_step_levels;
+  /// Node of every displacement dof and its cycle length
+  std::vector<dof_id_type> _node_ids;
+  std::vector<unsigned int> _cycle;
+  /// Level assignment _cycle was built for, 0 if none
+  unsigned int _levels_version;
+
+  ///Work arrays holding the gathered nodal values
+  std::vector<Number> _u;
+  std::vector<Number> _u_old;
+  std::vector<Number> _u_older;
+  std::vector<Number> _v;
+  std::vector<Number> _v_old;
+  std::vector<Number> _a;
+  std::vector<Number> _a_old;
+};
+
+#endif //EXPLICITNODALUPDATE_H
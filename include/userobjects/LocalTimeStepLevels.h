@@ -0,0 +1,96 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef LOCALTIMESTEPLEVELS_H
+#define LOCALTIMESTEPLEVELS_H
+
+#include "GeneralUserObject.h"
+
+#include <unordered_map>
+
+class LocalTimeStepLevels;
+
+template<>
+InputParameters validParams<LocalTimeStepLevels>();
+
+/**
+ * Multi-rate time stepping levels for explicit dynamics on graded meshes.
+ * Every element gets the level L with 2^L dt <= safety * hmin / wave_speed, and
+ * every node the level of its finest element. The explicit stress kernels of a
+ * level L element only compute its internal force every 2^L steps and then apply
+ * it 2^L times (impulse form).
+ *
+ * With a lumped mass a node whose elements are all of level L feels a force only
+ * at the start of each cycle, so central difference with dt moves it exactly as
+ * central difference with 2^L dt and linearly in between. The fine elements of a
+ * level interface therefore see the coarse nodes linearly interpolated in time,
+ * as in the subcycling of Belytschko and Lu. The interface nodes themselves take
+ * the level of their finest element; they receive the force of a coarse element
+ * as one impulse per cycle instead of spread over it, which keeps the momentum
+ * exchanged between the levels exact but is first order in time at the interface.
+ * The participating objects take time_step_levels:
+ *  - StressDivergenceExplicitTensors, StressDivergenceExpTensors and
+ *    StressDivergenceExpPFFracTensors apply the coarse forces as impulses,
+ *  - InertialForceExp must use the lumped mass, which keeps the nodes decoupled,
+ *  - ExplicitNodalUpdate reports the acceleration of a coarse node for its whole
+ *    cycle instead of the impulse of the cycle start.
+ *
+ * Limits:
+ *  - MOOSE still reinits every element and evaluates its materials every step,
+ *    only the kernel work is skipped; the lumped inertia is evaluated every step,
+ *  - safety below about 0.5 keeps clear of the resonances of the impulse method,
+ *  - wave_speed is one value for the whole mesh, use the largest p-wave speed,
+ *  - the levels are reassigned when dt or the mesh changes, which restarts all cycles,
+ *  - save_in of the participating kernels is not supported, it would record the impulses.
+ */
+class LocalTimeStepLevels : public GeneralUserObject
+{
+public:
+  LocalTimeStepLevels(const InputParameters & parameters);
+
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /**
+   * Returns true if the force of elem is computed in the current step and sets
+   * cycle to 2^level, the number of steps the force is applied for
+   */
+  bool active(const Elem * elem, unsigned int & cycle) const;
+
+  /// 2^level of the node, the number of steps of its cycle
+  unsigned int nodeCycle(dof_id_type node_id) const;
+
+  /// Steps since the cycles started, a cycle of length m starts when this is divisible by m
+  unsigned int stepInCycles() const;
+
+  /// Changes whenever the levels are reassigned
+  unsigned int version() const { return _version; }
+
+protected:
+  /// Assigns the levels of the elements and nodes of this rank, ghosts included, for the current dt and restarts the cycles
+  void assignLevels();
+
+  const Real _wave_speed;
+  const Real _safety;
+  const unsigned int _max_level;
+
+  std::unordered_map<dof_id_type, unsigned int> _levels;
+  std::unordered_map<dof_id_type, unsigned int> _node_levels;
+
+  /// dt the levels were assigned for
+  Real _assigned_dt;
+
+  /// Time step at which all cycles start
+  int _first_step;
+
+  /// Number of level assignments so far
+  unsigned int _version;
+};
+
+#endif //LOCALTIMESTEPLEVELS_H
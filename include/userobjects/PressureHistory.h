@@ -0,0 +1,59 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef PRESSUREHISTORY_H
+#define PRESSUREHISTORY_H
+
+#include "GeneralUserObject.h"
+
+class PressureHistory;
+
+template<>
+InputParameters validParams<PressureHistory>();
+
+/**
+ * Tabulated pressure time history, e.g. blast gauge data, for CoupledNeumannBC
+ * and CoupledNeumannVectorBC. The table is read once on rank 0, broadcast and
+ * kept in memory. Every row holds a time and one pressure per boundary segment:
+ *  - csv: comma or whitespace separated text, lines that do not start with a number are skipped
+ *  - binary: native doubles, rows of 1 + num_segments values without a header
+ * The times have to increase. At every execution the pressures are interpolated
+ * linearly at the current time, starting from the interval of the previous
+ * execution, and the boundary conditions read the cached values. Outside the
+ * table the first or last row is held.
+ */
+class PressureHistory : public GeneralUserObject
+{
+public:
+  PressureHistory(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /// Pressure of segment at the time of the last execution
+  Real value(unsigned int segment) const;
+
+  unsigned int numSegments() const { return _num_segments; }
+
+protected:
+  void readCSV();
+  void readBinary();
+
+  const FileName & _file;
+  const Real _scale;
+  unsigned int _num_segments;
+
+  std::vector<Real> _time;
+  ///Pressures, row major with num_segments entries per time
+  std::vector<Real> _data;
+
+  ///Interval [_time[_cursor], _time[_cursor + 1]) of the last execution
+  std::size_t _cursor;
+  std::vector<Real> _values;
+};
+
+#endif //PRESSUREHISTORY_H
@@ -0,0 +1,79 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ELASTICSTIFFNESSCACHE_H
+#define ELASTICSTIFFNESSCACHE_H
+
+#include "MooseTypes.h"
+#include "MooseVariable.h"
+#include "MaterialProperty.h"
+#include "RankFourTensor.h"
+
+#include "libmesh/elem.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Per-element storage of small strain elastic stiffness blocks for the explicit
+ * stress divergence kernels. All blocks are kept in one contiguous array so the
+ * internal force of an element reduces to a dense mat-vec with the nodal
+ * displacements. A block is treated as stale (and rebuilt by the kernel) once the
+ * quadrature summed elasticity tensor or the element volume no longer match the
+ * values it was assembled with.
+ */
+class ElasticStiffnessCache
+{
+public:
+  ElasticStiffnessCache(Real tolerance);
+
+  /// Returns the stored block for elem, or NULL if it is missing or stale
+  const Real * find(const Elem * elem, const RankFourTensor & elasticity, Real volume) const;
+
+  /**
+   * Returns storage of size n for the block of elem and records the elasticity
+   * tensor and volume it is going to be assembled with
+   */
+  Real * insert(const Elem * elem, const RankFourTensor & elasticity, Real volume, unsigned int n);
+
+  /// Drops all stored blocks
+  void clear();
+
+  /**
+   * Assembles the rows of the given displacement component of the element
+   * stiffness into ke, laid out as ke[i * ndisp * n_test + k * n_test + j]
+   */
+  static void assemble(Real * ke,
+                       unsigned int component,
+                       unsigned int ndisp,
+                       const VariableTestGradient & grad_test,
+                       const MooseArray<Real> & JxW,
+                       const MooseArray<Real> & coord,
+                       const MaterialProperty<RankFourTensor> & elasticity);
+
+  /// Adds the product of ke with the nodal displacements disp to re
+  static void multiply(const Real * ke,
+                       const std::vector<const VariableValue *> & disp,
+                       unsigned int ndisp,
+                       DenseVector<Number> & re);
+
+protected:
+  struct Entry
+  {
+    std::size_t _offset;
+    unsigned int _size;
+    RankFourTensor _elasticity;
+    Real _volume;
+  };
+
+  /// Relative tolerance for detecting a change of the elasticity tensor or volume
+  const Real _tolerance;
+
+  std::unordered_map<dof_id_type, Entry> _entries;
+  std::vector<Real> _data;
+};
+
+#endif //ELASTICSTIFFNESSCACHE_H
@@ -0,0 +1,48 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ENERGYSPLIT_H
+#define ENERGYSPLIT_H
+
+#include "MooseTypes.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+/**
+ * Volumetric-deviatoric split of the isotropic elastic energy,
+ * Amor, Marigo and Maurini, J. Mech. Phys. Solids, 2009, 57. 1209-1229.
+ * Unlike the spectral split it needs no eigen-decomposition of the strain.
+ */
+namespace EnergySplit
+{
+/**
+ * Splits the stress of strain into the part degraded by damage, stress_pos =
+ * K <tr e>+ I + 2 mu dev(e), and the undegraded compressive part with the sign
+ * convention of the damage materials, stress_neg = K <tr e>- I, so that the
+ * stress is g stress_pos - stress_neg. energy_pos = K/2 <tr e>+^2 + mu dev(e):dev(e)
+ * and stress_pos is its derivative with respect to the strain.
+ */
+void volumetricDeviatoric(const RankTwoTensor & strain,
+                          Real lambda,
+                          Real mu,
+                          RankTwoTensor & stress_pos,
+                          RankTwoTensor & stress_neg,
+                          Real & energy_pos);
+
+/// Derivative of stress_pos of volumetricDeviatoric with respect to the strain
+RankFourTensor volumetricDeviatoricTangent(const RankTwoTensor & strain, Real lambda, Real mu);
+
+/**
+ * Derivative of the tensile stress of the spectral split (Miehe),
+ * lambda <tr e>+ I + 2 mu sum_a <e_a>+ n_a n_a, with respect to the strain.
+ * eigval and the columns of eigvec are the eigenpairs of the strain. Includes
+ * the rotation of the eigenvectors, weighted by (<e_a>+ - <e_b>+) / (e_a - e_b).
+ * With an isotropic C the tangent of g stress_pos - stress_neg is C - (1 - g) C+.
+ */
+RankFourTensor spectralTangent(const std::vector<Real> & eigval, const RankTwoTensor & eigvec, Real lambda, Real mu);
+}
+
+#endif //ENERGYSPLIT_H
@@ -0,0 +1,39 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef ENSEMBLERANDOM_H
+#define ENSEMBLERANDOM_H
+
+#include "MooseTypes.h"
+
+class MooseMesh;
+
+/**
+ * Stateless random numbers for Monte Carlo realizations. The values only depend
+ * on the realization, the element id and the quadrature point, so they do not
+ * depend on the partitioning, the thread layout or the evaluation order.
+ */
+namespace EnsembleRandom
+{
+/// Uniform number in [0, 1) for the given realization, element and qp
+Real uniform(unsigned int realization, dof_id_type elem_id, unsigned int qp);
+
+/**
+ * Maps the uniform number u of the base run to the realization by a random
+ * rotation of the unit interval. The result is again uniform on [0, 1) and
+ * independent of u. Realization 0 returns u unchanged.
+ */
+Real shift(Real u, unsigned int realization, dof_id_type elem_id, unsigned int qp);
+
+/**
+ * Errors out if the element ids may depend on the partitioning. A distributed
+ * mesh is renumbered per rank count unless allow_renumbering = false, which
+ * would make the random fields change with the number of ranks.
+ */
+void checkElemIds(const MooseMesh & mesh, const std::string & object_name);
+}
+
+#endif //ENSEMBLERANDOM_H
@@ -0,0 +1,144 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EXPLICITELEMENTKERNELS_H
+#define EXPLICITELEMENTKERNELS_H
+
+#include "MooseTypes.h"
+#include "MooseVariable.h"
+#include "MaterialProperty.h"
+#include "RankFourTensor.h"
+
+#include "libmesh/elem.h"
+
+/**
+ * Element residuals of the explicit kernels with the number of nodes, quadrature
+ * points and dimensions known at compile time, so the loops over them are
+ * unrolled and vectorized. Instances exist for first order QUAD4 and HEX8
+ * elements with one point or full Gauss integration in Cartesian coordinates.
+ * The dispatch functions return false for everything else and the kernels then
+ * use their generic per (i, qp) path.
+ */
+namespace ExplicitElementKernels
+{
+enum Shape
+{
+  Generic,
+  Quad4Q1,
+  Quad4Q4,
+  Hex8Q1,
+  Hex8Q8
+};
+
+/// Specialized shape of the current element, Generic if there is none
+Shape shape(const Elem * elem, unsigned int n_qp, unsigned int n_test);
+
+/**
+ * Adds the internal force of the given displacement component, the integral of
+ * (C : sym(grad u)).row(component) . grad test, to re. grad_disp holds one
+ * gradient per dimension.
+ */
+template <unsigned int N_NODES, unsigned int N_QP, unsigned int DIM>
+void
+stressDivergence(unsigned int component,
+                 const VariableTestGradient & grad_test,
+                 const MooseArray<Real> & JxW,
+                 const MooseArray<Real> & coord,
+                 const MaterialProperty<RankFourTensor> & elasticity,
+                 const std::vector<const VariableGradient *> & grad_disp,
+                 DenseVector<Number> & re)
+{
+  //Weighted stress row of every qp, so every test function only needs a dot product
+  Real stress[N_QP][DIM];
+
+  for (unsigned int qp = 0; qp < N_QP; ++qp)
+  {
+    Real strain[DIM][DIM];
+    for (unsigned int k = 0; k < DIM; ++k)
+      for (unsigned int m = 0; m < DIM; ++m)
+        strain[k][m] = 0.5 * ((*grad_disp[k])[qp](m) + (*grad_disp[m])[qp](k));
+
+    const RankFourTensor & C = elasticity[qp];
+    const Real w = JxW[qp] * coord[qp];
+    for (unsigned int l = 0; l < DIM; ++l)
+    {
+      Real val = 0.0;
+      for (unsigned int k = 0; k < DIM; ++k)
+        for (unsigned int m = 0; m < DIM; ++m)
+          val += C(component, l, k, m) * strain[k][m];
+      stress[qp][l] = w * val;
+    }
+  }
+
+  for (unsigned int i = 0; i < N_NODES; ++i)
+  {
+    Real val = 0.0;
+    for (unsigned int qp = 0; qp < N_QP; ++qp)
+      for (unsigned int l = 0; l < DIM; ++l)
+        val += stress[qp][l] * grad_test[i][qp](l);
+    re(i) += val;
+  }
+}
+
+/**
+ * Adds the mass term of a rate to re: coeff * density * rate * test, with the
+ * rate given per node for the lumped mass and per qp otherwise. density may be NULL.
+ */
+template <unsigned int N_NODES, unsigned int N_QP>
+void
+mass(const VariableTestValue & test,
+     const MooseArray<Real> & JxW,
+     const MooseArray<Real> & coord,
+     const MaterialProperty<Real> * density,
+     Real coeff,
+     bool lumped,
+     const Real * rate,
+     DenseVector<Number> & re)
+{
+  Real w[N_QP];
+  for (unsigned int qp = 0; qp < N_QP; ++qp)
+    w[qp] = coeff * JxW[qp] * coord[qp] * (density ? (*density)[qp] : 1.0);
+
+  for (unsigned int i = 0; i < N_NODES; ++i)
+  {
+    Real val = 0.0;
+    if (lumped)
+    {
+      for (unsigned int qp = 0; qp < N_QP; ++qp)
+        val += test[i][qp] * w[qp];
+      val *= rate[i];
+    }
+    else
+      for (unsigned int qp = 0; qp < N_QP; ++qp)
+        val += test[i][qp] * w[qp] * rate[qp];
+    re(i) += val;
+  }
+}
+
+/// Dispatches stressDivergence on the shape of elem, returns false if it has no specialization
+bool stressDivergence(const Elem * elem,
+                      unsigned int component,
+                      const VariableTestGradient & grad_test,
+                      const MooseArray<Real> & JxW,
+                      const MooseArray<Real> & coord,
+                      const MaterialProperty<RankFourTensor> & elasticity,
+                      const std::vector<const VariableGradient *> & grad_disp,
+                      unsigned int ndisp,
+                      DenseVector<Number> & re);
+
+/// Dispatches mass on the shape of elem, returns false if it has no specialization
+bool mass(const Elem * elem,
+          const VariableTestValue & test,
+          const MooseArray<Real> & JxW,
+          const MooseArray<Real> & coord,
+          const MaterialProperty<Real> * density,
+          Real coeff,
+          bool lumped,
+          const Real * rate,
+          DenseVector<Number> & re);
+}
+
+#endif //EXPLICITELEMENTKERNELS_H
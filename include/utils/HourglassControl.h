@@ -0,0 +1,69 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef HOURGLASSCONTROL_H
+#define HOURGLASSCONTROL_H
+
+#include "MooseTypes.h"
+#include "MooseVariable.h"
+#include "RankFourTensor.h"
+
+#include "libmesh/elem.h"
+
+/**
+ * Flanagan-Belytschko stiffness hourglass control for one point integrated
+ * QUAD4 and HEX8 elements. The hourglass shape vectors are built from the
+ * element coordinates and the shape function gradients at the single (centroid)
+ * quadrature point, so they are orthogonal to the linear displacement fields.
+ * Refer to Flanagan and Belytschko, Int. J. Num. Methods Engg., 1981, 17. 679-706
+ */
+namespace HourglassControl
+{
+/// True for QUAD4 and HEX8 elements integrated with a single quadrature point
+bool supported(const Elem * elem, unsigned int n_qp);
+
+/**
+ * Hourglass stiffness of the element: coefficient * (lambda + 2 mu) * V * sum_a b_a.b_a / dim,
+ * scaled by the damage degradation of the element
+ */
+Real stiffness(const Elem * elem,
+               Real coefficient,
+               Real lambda,
+               Real mu,
+               Real degradation,
+               Real volume,
+               const VariableTestGradient & grad_test);
+
+/**
+ * Adds the hourglass resisting force of one displacement component to re,
+ * given the nodal values u of that component
+ */
+void addForce(const Elem * elem,
+              const VariableTestGradient & grad_test,
+              const VariableValue & u,
+              Real stiffness,
+              DenseVector<Number> & re);
+
+/**
+ * Adds the hourglass force of one displacement component of a supported element to re
+ * and to the save_in variables, from the nodal old displacements u_old of the component.
+ * The isotropic elasticity tensor is scaled by degradation, which should be taken at
+ * the same (old) state as the displacements. local_re is a work vector.
+ */
+void addResidual(const Elem * elem,
+                 unsigned int n_qp,
+                 Real coefficient,
+                 const RankFourTensor & elasticity,
+                 Real degradation,
+                 Real volume,
+                 const VariableTestGradient & grad_test,
+                 const VariableValue & u_old,
+                 DenseVector<Number> & local_re,
+                 DenseVector<Number> & re,
+                 const std::vector<MooseVariable *> & save_in);
+}
+
+#endif //HOURGLASSCONTROL_H
@@ -0,0 +1,139 @@
+#Thread scaling benchmark for the colored explicit force assembly: the wave of
+#explicit_wave_threads.i with the internal force assembled by ExplicitForceAssembler
+#over element colors and added by nodal kernels, instead of the stress divergence
+#kernels and their locked residual scatter.
+#Run with run_thread_scaling.sh, the mesh size can be changed with Mesh/nx=... Mesh/ny=...
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1000
+  ny = 1000
+  xmax = 1.0
+  ymax = 1.0
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./vel_x]
+  [../]
+  [./vel_y]
+  [../]
+  [./accel_x]
+  [../]
+  [./accel_y]
+  [../]
+  [./force_x]
+  [../]
+  [./force_y]
+  [../]
+[]
+
+[Functions]
+  [./pulse]
+    type = ParsedFunction
+    value = 'if(t<2e-6,-1e-3*sin(pi*t/2e-6),0)'
+  [../]
+[]
+
+[Kernels]
+  [./inertia_x]
+    type = InertialForceExp
+    variable = disp_x
+    use_lumped_mass = true
+    use_displaced_mesh = false
+  [../]
+  [./inertia_y]
+    type = InertialForceExp
+    variable = disp_y
+    use_lumped_mass = true
+    use_displaced_mesh = false
+  [../]
+[]
+
+[NodalKernels]
+  [./solid_x]
+    type = ExplicitNodalForce
+    variable = disp_x
+    force = force_x
+  [../]
+  [./solid_y]
+    type = ExplicitNodalForce
+    variable = disp_y
+    force = force_y
+  [../]
+[]
+
+[BCs]
+  [./bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./top_pressure]
+    type = FunctionNeumannBC
+    variable = disp_y
+    boundary = top
+    function = pulse
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '120.0 80.0'
+    fill_method = symmetric_isotropic
+  [../]
+  [./density]
+    type = GenericConstantMaterial
+    prop_names = density
+    prop_values = 1e-3
+  [../]
+[]
+
+[UserObjects]
+  [./nodal_update]
+    type = ExplicitNodalUpdate
+    scheme = central_difference
+    displacements = 'disp_x disp_y'
+    velocities = 'vel_x vel_y'
+    accelerations = 'accel_x accel_y'
+  [../]
+  [./internal_force]
+    type = ExplicitForceAssembler
+    displacements = 'disp_x disp_y'
+    forces = 'force_x force_y'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  #The lumped mass is the whole Jacobian, so one Jacobi preconditioned solve per step is exact
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type -ksp_type'
+  petsc_options_value = 'jacobi   preonly'
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-16
+  nl_max_its = 3
+
+  dt = 1e-8
+  num_steps = 200
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
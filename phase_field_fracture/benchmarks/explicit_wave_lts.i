@@ -0,0 +1,144 @@
+#Multi-rate explicit dynamics on a graded mesh: elastic wave from a pressure pulse on
+#the top edge, where the elements are about 30 times smaller than at the bottom.
+#dt is set by the top elements, LocalTimeStepLevels lets the coarser elements compute
+#their forces less often. Compare the run time with time_step_levels removed.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 50
+  ny = 100
+  bias_y = 0.96
+  xmax = 1.0
+  ymax = 1.0
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./vel_x]
+  [../]
+  [./vel_y]
+  [../]
+  [./accel_x]
+  [../]
+  [./accel_y]
+  [../]
+[]
+
+[Functions]
+  [./pulse]
+    type = ParsedFunction
+    value = 'if(t<2e-4,-1e-3*sin(pi*t/2e-4),0)'
+  [../]
+[]
+
+[Kernels]
+  [./inertia_x]
+    type = InertialForceExp
+    variable = disp_x
+    use_lumped_mass = true
+    use_displaced_mesh = false
+    time_step_levels = levels
+  [../]
+  [./inertia_y]
+    type = InertialForceExp
+    variable = disp_y
+    use_lumped_mass = true
+    use_displaced_mesh = false
+    time_step_levels = levels
+  [../]
+  [./solid_x]
+    type = StressDivergenceExplicitTensors
+    variable = disp_x
+    displacements = 'disp_x disp_y'
+    component = 0
+    cache_stiffness = true
+    time_step_levels = levels
+  [../]
+  [./solid_y]
+    type = StressDivergenceExplicitTensors
+    variable = disp_y
+    displacements = 'disp_x disp_y'
+    component = 1
+    cache_stiffness = true
+    time_step_levels = levels
+  [../]
+[]
+
+[BCs]
+  [./bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./top_pressure]
+    type = FunctionNeumannBC
+    variable = disp_y
+    boundary = top
+    function = pulse
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '120.0 80.0'
+    fill_method = symmetric_isotropic
+  [../]
+  [./density]
+    type = GenericConstantMaterial
+    prop_names = density
+    prop_values = 1e-3
+  [../]
+[]
+
+[UserObjects]
+  [./levels]
+    type = LocalTimeStepLevels
+    #sqrt((lambda + 2 mu) / rho)
+    wave_speed = 529
+    safety = 0.5
+  [../]
+  [./nodal_update]
+    type = ExplicitNodalUpdate
+    scheme = central_difference
+    displacements = 'disp_x disp_y'
+    velocities = 'vel_x vel_y'
+    accelerations = 'accel_x accel_y'
+    #Coarse nodes report their acceleration over the whole cycle
+    time_step_levels = levels
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  #The lumped mass is the whole Jacobian, so one Jacobi preconditioned solve per step is exact
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type -ksp_type'
+  petsc_options_value = 'jacobi   preonly'
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-16
+  nl_max_its = 3
+
+  #Smallest element 7.2e-4, stable dt 1.4e-6
+  dt = 1e-6
+  num_steps = 2000
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
@@ -0,0 +1,129 @@
+#Thread scaling benchmark for the explicit path: elastic wave from a pressure
+#pulse on the top edge, central difference with lumped mass.
+#Run with run_thread_scaling.sh, the mesh size can be changed with Mesh/nx=... Mesh/ny=...
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1000
+  ny = 1000
+  xmax = 1.0
+  ymax = 1.0
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./vel_x]
+  [../]
+  [./vel_y]
+  [../]
+  [./accel_x]
+  [../]
+  [./accel_y]
+  [../]
+[]
+
+[Functions]
+  [./pulse]
+    type = ParsedFunction
+    value = 'if(t<2e-6,-1e-3*sin(pi*t/2e-6),0)'
+  [../]
+[]
+
+[Kernels]
+  [./inertia_x]
+    type = InertialForceExp
+    variable = disp_x
+    use_lumped_mass = true
+    use_displaced_mesh = false
+  [../]
+  [./inertia_y]
+    type = InertialForceExp
+    variable = disp_y
+    use_lumped_mass = true
+    use_displaced_mesh = false
+  [../]
+  [./solid_x]
+    type = StressDivergenceExplicitTensors
+    variable = disp_x
+    displacements = 'disp_x disp_y'
+    component = 0
+    cache_stiffness = true
+  [../]
+  [./solid_y]
+    type = StressDivergenceExplicitTensors
+    variable = disp_y
+    displacements = 'disp_x disp_y'
+    component = 1
+    cache_stiffness = true
+  [../]
+[]
+
+[BCs]
+  [./bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./top_pressure]
+    type = FunctionNeumannBC
+    variable = disp_y
+    boundary = top
+    function = pulse
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '120.0 80.0'
+    fill_method = symmetric_isotropic
+  [../]
+  [./density]
+    type = GenericConstantMaterial
+    prop_names = density
+    prop_values = 1e-3
+  [../]
+[]
+
+[UserObjects]
+  [./nodal_update]
+    type = ExplicitNodalUpdate
+    scheme = central_difference
+    displacements = 'disp_x disp_y'
+    velocities = 'vel_x vel_y'
+    accelerations = 'accel_x accel_y'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  #The lumped mass is the whole Jacobian, so one Jacobi preconditioned solve per step is exact
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type -ksp_type'
+  petsc_options_value = 'jacobi   preonly'
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-16
+  nl_max_its = 3
+
+  dt = 1e-8
+  num_steps = 200
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
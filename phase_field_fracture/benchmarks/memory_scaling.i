@@ -0,0 +1,183 @@
+#Memory scaling benchmark of the implicit phase-field fracture path on a distributed mesh.
+#Tension of a square plate, two steps. The per rank resident memory after the setup is written
+#to the csv file. GeneratedMesh builds the whole mesh on every rank before the remote elements
+#are deleted, so the peak memory would not fall with the rank count: the current memory is
+#sampled at the end of the steps instead, and the peak is reported for reference only.
+#Run with run_memory_scaling.sh, the mesh size can be changed with Mesh/nx=... Mesh/ny=...
+#No exodus output: ExodusII writes a serialized copy of the mesh on rank 0.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 500
+  ny = 500
+  xmax = 1.0
+  ymax = 1.0
+  parallel_type = distributed
+  #The random gc field is keyed by element id
+  allow_renumbering = false
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./c]
+  [../]
+  [./b]
+  [../]
+[]
+
+[Functions]
+  [./tfunc]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Kernels]
+  [./pfbulk]
+    type = PFFracBulkRate
+    variable = c
+    l = 0.08
+    beta = b
+    visco =1e-4
+    gc_prop_var = 'gc_prop'
+    G0_var = 'G0_pos'
+    dG0_dstrain_var = 'dG0_pos_dstrain'
+  [../]
+  [./DynamicTensorMechanics]
+    displacements = 'disp_x disp_y'
+  [../]
+  [./solid_x]
+    type = PhaseFieldFractureMechanicsOffDiag
+    variable = disp_x
+    component = 0
+    c = c
+  [../]
+  [./solid_y]
+    type = PhaseFieldFractureMechanicsOffDiag
+    variable = disp_y
+    component = 1
+    c = c
+  [../]
+  [./dcdt]
+    type = TimeDerivative
+    variable = c
+  [../]
+  [./pfintvar]
+    type = Reaction
+    variable = b
+  [../]
+  [./pfintcoupled]
+    type = PFFracCoupledInterface
+    variable = b
+    c = c
+  [../]
+[]
+
+[BCs]
+  [./ydisp]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = top
+    function = tfunc
+  [../]
+  [./yfix]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./xfix]
+    type = PresetBC
+    variable = disp_x
+    boundary = 'bottom top'
+    value = 0
+  [../]
+[]
+
+[Materials]
+  [./pfbulkmat]
+    type = PFFracRandomBulkRateMaterial
+    gc = 1e-3
+    pC = 0.1
+  [../]
+  [./elastic]
+    type = LinearIsoElasticPFDamageModify
+    c = c
+    kdamage = 1e-8
+  [../]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '120.0 80.0'
+    fill_method = symmetric_isotropic
+  [../]
+  [./strain]
+    type = ComputeSmallStrain
+  [../]
+[]
+
+[Postprocessors]
+  [./n_elems]
+    type = NumElems
+    execute_on = initial
+  [../]
+  [./resid_y]
+    type = BoundaryReactionForce
+    component = 1
+    boundary = top
+  [../]
+  [./dc_max]
+    type = MaxDamageIncrement
+    variable = c
+  [../]
+  [./memory_max]
+    type = RankMemory
+    value_type = max_over_ranks
+  [../]
+  [./memory_min]
+    type = RankMemory
+    value_type = min_over_ranks
+  [../]
+  [./memory_average]
+    type = RankMemory
+    value_type = average
+  [../]
+  [./memory_peak]
+    type = RankMemory
+    memory_type = peak
+    value_type = max_over_ranks
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -ksp_gmres_restart -sub_ksp_type -sub_pc_type -pc_asm_overlap'
+  petsc_options_value = 'asm      31                  preonly       ilu          1'
+
+  nl_rel_tol = 1e-8
+  l_max_its = 30
+  nl_max_its = 10
+
+  dt = 1e-4
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -0,0 +1,230 @@
+#Check of DamageWeightedRepartitioner on 2 ranks: tension of a notched plate with the
+#history of G0_pos (historyEng = true), repartitioned at step 3. The mesh starts out with
+#a radial centroid partitioning, which the graph partitioners never reproduce, so the
+#forced repartitioning moves elements. The csv history must match a run without the
+#repartitioning (repartition_steps = -1) up to the solver tolerance, for both
+#Mesh/parallel_type=replicated and Mesh/parallel_type=distributed.
+#Run with run_repartition_check.sh.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 40
+  xmax = 1.0
+  ymax = 1.0
+  partitioner = centroid
+  centroid_partitioner_direction = radial
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./c]
+  [../]
+  [./b]
+  [../]
+[]
+
+[AuxVariables]
+  [./G0_pos]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./tfunc]
+    type = ParsedFunction
+    value = 5*t
+  [../]
+  #Initial crack along the left half of the middle line
+  [./notch]
+    type = ParsedFunction
+    value = 'if(x<0.5,exp(-abs(y-0.5)/0.02),0)'
+  [../]
+[]
+
+[ICs]
+  [./c]
+    type = FunctionIC
+    variable = c
+    function = notch
+  [../]
+[]
+
+[Kernels]
+  [./pfbulk]
+    type = CohesivePFFracBulkRate
+    variable = c
+    l = 0.04
+    p = 3
+    beta = b
+    visco = 1e-4
+    gc_prop_var = 'gc_prop'
+    G0_var = 'G0_pos'
+    dG0_dstrain_var = 'dG0_pos_dstrain'
+    Emod = 'E'
+    sigmac = 'sc'
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+  [./DynamicTensorMechanics]
+    displacements = 'disp_x disp_y'
+  [../]
+  [./solid_x]
+    type = PhaseFieldFractureMechanicsOffDiag
+    variable = disp_x
+    component = 0
+    c = c
+  [../]
+  [./solid_y]
+    type = PhaseFieldFractureMechanicsOffDiag
+    variable = disp_y
+    component = 1
+    c = c
+  [../]
+  [./dcdt]
+    type = TimeDerivative
+    variable = c
+  [../]
+  [./pfintvar]
+    type = Reaction
+    variable = b
+  [../]
+  [./pfintcoupled]
+    type = PFFracCoupledInterface
+    variable = b
+    c = c
+  [../]
+[]
+
+[AuxKernels]
+  [./G0_pos]
+    type = MaterialRealAux
+    variable = G0_pos
+    property = G0_pos
+    execute_on = timestep_end
+  [../]
+[]
+
+[BCs]
+  [./ydisp]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = top
+    function = tfunc
+  [../]
+  [./yfix]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./xfix]
+    type = PresetBC
+    variable = disp_x
+    boundary = 'bottom top'
+    value = 0
+  [../]
+[]
+
+[Materials]
+  [./pfbulkmat]
+    type = PFFracBulkRateMaterial
+    gc = 2.7e-3
+  [../]
+  [./elastic]
+    type = CohesiveLinearIsoElasticPFDamage
+    c = c
+    kdamage = 1e-8
+    historyEng = true
+    gc_prop_var = 'gc_prop'
+    Emod = 'E'
+    sigmac = 'sc'
+    l = 0.04
+    p = 3
+  [../]
+  [./constant]
+    type = GenericConstantMaterial
+    prop_names = 'E sc'
+    prop_values = '210.0 0.8646'
+  [../]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '121.0 81.0'
+    fill_method = symmetric_isotropic
+  [../]
+  [./strain]
+    type = ComputeSmallStrain
+  [../]
+[]
+
+[Postprocessors]
+  #The history is checked through the stateful G0_pos, the solution through norms and the reaction
+  [./G0_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = G0_pos
+  [../]
+  [./G0_max]
+    type = ElementExtremeValue
+    variable = G0_pos
+    value_type = max
+  [../]
+  [./c_norm]
+    type = ElementL2Norm
+    variable = c
+  [../]
+  [./disp_y_norm]
+    type = ElementL2Norm
+    variable = disp_y
+  [../]
+  [./resid_y]
+    type = BoundaryReactionForce
+    component = 1
+    boundary = top
+  [../]
+[]
+
+[UserObjects]
+  [./repartitioner]
+    type = DamageWeightedRepartitioner
+    damage = c
+    #Only the forced repartitioning
+    imbalance_threshold = 1e6
+    repartition_steps = 3
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  #Tight tolerances, the partitioning changes the ASM preconditioner
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -sub_pc_type -pc_asm_overlap'
+  petsc_options_value = 'asm      lu           1'
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+  l_tol = 1e-10
+  l_max_its = 100
+  nl_max_its = 20
+
+  dt = 1e-4
+  num_steps = 6
+[]
+
+[Outputs]
+  csv = true
+[]
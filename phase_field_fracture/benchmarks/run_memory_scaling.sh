@@ -0,0 +1,21 @@
+#!/bin/bash
+#Per rank resident memory of the distributed mesh after the setup versus mesh size and rank count.
+#usage: run_memory_scaling.sh [max_ranks] [sizes]
+MAX_RANKS=${1:-16}
+SIZES=${2:-"250 500 1000"}
+DIR=$(cd "$(dirname "$0")" && pwd)
+APP=${APP:-$DIR/../../ASFracture-opt}
+MPIEXEC=${MPIEXEC:-mpiexec}
+
+echo "nx,ranks,n_elems,max_mb,min_mb,average_mb,peak_mb"
+for nx in $SIZES; do
+  n=1
+  while [ $n -le $MAX_RANKS ]; do
+    base=$DIR/memory_scaling_${nx}_$n
+    $MPIEXEC -n $n $APP -i $DIR/memory_scaling.i Mesh/nx=$nx Mesh/ny=$nx Outputs/file_base=$base > $base.log 2>&1 || exit 1
+    awk -F, -v nx=$nx -v n=$n 'NR == 1 {for (i = 1; i <= NF; i++) col[$i] = i; next}
+      {line = nx "," n "," $col["n_elems"] "," $col["memory_max"] "," $col["memory_min"] "," $col["memory_average"] "," $col["memory_peak"]}
+      END {print line}' $base.csv
+    n=$((n * 2))
+  done
+done
@@ -0,0 +1,47 @@
+#!/bin/bash
+#Runs repartition_2rank.i on 2 ranks with and without the forced repartitioning at step 3,
+#for a replicated and a distributed mesh, and compares the csv histories.
+#usage: run_repartition_check.sh [relative_tolerance]
+TOL=${1:-1e-6}
+DIR=$(cd "$(dirname "$0")" && pwd)
+APP=${APP:-$DIR/../../ASFracture-opt}
+MPIEXEC=${MPIEXEC:-mpiexec}
+status=0
+
+for type in replicated distributed; do
+  ref=$DIR/repartition_2rank_${type}_ref
+  moved=$DIR/repartition_2rank_${type}
+  $MPIEXEC -n 2 $APP -i $DIR/repartition_2rank.i Mesh/parallel_type=$type UserObjects/repartitioner/repartition_steps=-1 Outputs/file_base=$ref > $ref.log 2>&1 || exit 1
+  $MPIEXEC -n 2 $APP -i $DIR/repartition_2rank.i Mesh/parallel_type=$type Outputs/file_base=$moved > $moved.log 2>&1 || exit 1
+
+  #The check is void if nothing moved
+  n_moved=$(sed -n 's/.*DamageWeightedRepartitioner: imbalance [^,]*, \([0-9]*\) elements moved.*/\1/p' $moved.log | head -1)
+  if [ -z "$n_moved" ] || [ "$n_moved" -eq 0 ]; then
+    echo "$type: the repartitioning moved no elements"
+    status=1
+    continue
+  fi
+
+  #Every value of every step, including the ones before the repartitioning, within TOL
+  if paste -d, $ref.csv $moved.csv | awk -F, -v tol=$TOL -v type=$type '
+    NR == 1 {n = NF / 2; for (i = 1; i <= n; i++) name[i] = $i; next}
+    {
+      for (i = 2; i <= n; i++)
+      {
+        a = $i; b = $(i + n); d = a - b; if (d < 0) d = -d
+        s = (a < 0 ? -a : a) + (b < 0 ? -b : b)
+        if (d > tol * s + 1e-14)
+        {
+          printf "%s: %s differs at time %s: %s vs %s\n", type, name[i], $1, a, b
+          bad = 1
+        }
+      }
+    }
+    END {exit bad}'; then
+    echo "$type: $n_moved elements moved, histories match"
+  else
+    status=1
+  fi
+done
+
+exit $status
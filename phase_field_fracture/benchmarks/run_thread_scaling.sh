@@ -0,0 +1,20 @@
+#!/bin/bash
+#Thread scaling of the explicit path on one rank: the stress divergence kernels
+#(explicit_wave_threads.i) against the colored force assembly (explicit_wave_colored.i).
+#usage: run_thread_scaling.sh [max_threads] [nx]
+MAX_THREADS=${1:-16}
+NX=${2:-1000}
+DIR=$(cd "$(dirname "$0")" && pwd)
+APP=${APP:-$DIR/../../ASFracture-opt}
+
+echo "input,threads,wall_seconds"
+for input in explicit_wave_threads explicit_wave_colored; do
+  t=1
+  while [ $t -le $MAX_THREADS ]; do
+    start=$(date +%s.%N)
+    $APP -i $DIR/$input.i --n-threads=$t Mesh/nx=$NX Mesh/ny=$NX > $DIR/${input}_$t.log 2>&1 || exit 1
+    end=$(date +%s.%N)
+    echo "$input,$t,$(echo "$end - $start" | bc)"
+    t=$((t * 2))
+  done
+done
@@ -20,14 +20,14 @@
 []
 
 [AuxVariables]
-  [./resid_x]
-  [../]
-  [./resid_y]
-  [../]
   [./stress_yy]
     order = CONSTANT
     family = MONOMIAL
   [../]
+  [./G0_pos]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
 []
 
 [Functions]
@@ -50,7 +50,6 @@
   [../]
   [./DynamicTensorMechanics]
     displacements = 'disp_x disp_y'
-    save_in = 'resid_x resid_y'
   [../]
   [./solid_x]
     type = PhaseFieldFractureMechanicsOffDiag
@@ -88,6 +87,12 @@
     index_i = 1
     execute_on = timestep_end
   [../]
+  [./G0_pos]
+    type = MaterialRealAux
+    variable = G0_pos
+    property = G0_pos
+    execute_on = timestep_end
+  [../]
 []
 
 [BCs]
@@ -133,15 +138,36 @@
 
 [Postprocessors]
   [./resid_x]
-    type = NodalSum
-    variable = resid_x
+    type = BoundaryReactionForce
+    component = 0
     boundary = 2
   [../]
   [./resid_y]
-    type = NodalSum
-    variable = resid_y
+    type = BoundaryReactionForce
+    component = 1
     boundary = 2
   [../]
+  [./dc_max]
+    type = MaxDamageIncrement
+    variable = c
+  [../]
+  [./G0_max]
+    type = ElementExtremeValue
+    variable = G0_pos
+    value_type = max
+  [../]
+[]
+
+[UserObjects]
+  [./jacobian_lagging]
+    type = ElasticPhaseJacobianLagging
+    damage = c
+    #Damage rate at c = 0 is about 2 G0 / (gc visco), so a step of dt = 1e-4 changes c by
+    #more than damage_tol once G0 exceeds damage_tol gc visco / (2 dt) = 5e-8
+    damage_tol = 1e-4
+    energy = G0_max
+    energy_threshold = 5e-8
+  [../]
 []
 
 [Preconditioning]
@@ -163,9 +189,20 @@
   l_max_its = 10
   nl_max_its = 10
 
-  dt = 1e-4
-  dtmin = 1e-4
+  dtmin = 1e-6
   num_steps = 2
+
+  [./TimeStepper]
+    type = DamageControlledTimeStepper
+    dt = 1e-4
+    dt_min = 1e-6
+    damage_increment = dc_max
+    target_damage_increment = 0.05
+  [../]
+  [./Predictor]
+    type = DamagePredictor
+    damage = c
+  [../]
 []
 
 [Outputs]
@@ -1,6 +1,6 @@
 #Fix y displacement on the left side
 [Mesh]
-  type = FileMesh
+  type = CachedFileMesh
   file = crack_mesh.e
   uniform_refine = 2
 []
@@ -21,13 +21,17 @@
   [../]
   [./disp_y_in]
   [../]
+  [./G0_pos]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
 []
 
 [Kernels]
   [./pfbulk]
      type = CohesivePFFracBulkRate
      variable = d
-     ifOld = true
+     ifOld = false
      l = 0.04
      p = 3
      beta = b
@@ -56,6 +60,14 @@
    [../]
 []
 
+[AuxKernels]
+  [./G0_pos]
+    type = MaterialRealAux
+    variable = G0_pos
+    property = G0_pos
+    execute_on = timestep_end
+  [../]
+[]
 
 [Materials]
   [./pfbulkmat]
@@ -93,6 +105,18 @@
 []
 
 
+[Postprocessors]
+  [./dd_max]
+    type = MaxDamageIncrement
+    variable = d
+  [../]
+  [./G0_max]
+    type = ElementExtremeValue
+    variable = G0_pos
+    value_type = max
+  [../]
+[]
+
 [Preconditioning]
   active = 'smp'
   [./smp]
@@ -115,11 +139,21 @@
   l_max_its = 30
   nl_max_its = 30
 
-  dt = 1e-4
   dtmin = 1e-10
   start_time = 0.0
   end_time = 1
   #num_steps = 2
+
+  [./TimeStepper]
+    type = DamageControlledTimeStepper
+    dt = 1e-4
+    dt_min = 1e-10
+    damage_increment = dd_max
+    target_damage_increment = 0.05
+    #Cohesive onset sigmac^2 / 2E
+    energy = G0_max
+    energy_threshold = 1.78e-3
+  [../]
 []
 
 [Outputs]
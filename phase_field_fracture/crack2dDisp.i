@@ -1,6 +1,6 @@
 #Fix y displacement on the left side
 [Mesh]
-  type = FileMesh
+  type = CachedFileMesh
   file = crack_mesh.e
   uniform_refine = 2
 []
@@ -17,10 +17,6 @@
 []
 
 [AuxVariables]
-  [./resid_x]
-  [../]
-  [./resid_y]
-  [../]
   [./stress_xy]
     order = CONSTANT
     family = MONOMIAL
@@ -55,7 +51,6 @@
 
   [./TensorMechanics]
     displacements = 'disp_x disp_y'
-#    save_in = 'resid_x resid_y'
   [../]
   [./solid_x]
     type = PhaseFieldFractureMechanicsOffDiag
@@ -140,13 +135,13 @@
 
 [Postprocessors]
   [./resid_x]
-    type = NodalSum
-    variable = resid_x
+    type = BoundaryReactionForce
+    component = 0
     boundary = 2
   [../]
   [./resid_y]
-    type = NodalSum
-    variable = resid_y
+    type = BoundaryReactionForce
+    component = 1
     boundary = 2
   [../]
 []
@@ -162,7 +157,10 @@
 [Executioner]
   type = Transient
 
-  solve_type = PJFNK
+  #The damage d_in is prescribed, so the Jacobian is the degraded split tangent of
+  #the damage material. It is exact, so Newton with the assembled matrix replaces
+  #the finite difference matvec of PJFNK.
+  solve_type = NEWTON
   petsc_options_iname = '-pc_type -ksp_gmres_restart -sub_ksp_type -sub_pc_type -pc_asm_overlap'
   petsc_options_value = 'asm      31                  preonly       lu           1'
 
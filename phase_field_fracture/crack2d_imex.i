@@ -0,0 +1,267 @@
+#Element partitioned implicit-explicit (IMEX) dynamic fracture of a notched plate.
+#Block 1 (the crack zone) is integrated implicitly, block 0 explicitly with the lumped
+#mass and the old displacements. CrackZoneSubdomainModifier moves damaged elements and
+#a buffer around them from block 0 to block 1, so the zone follows the crack.
+#All displacement dofs share the central difference inertia, the displacement dofs of the
+#explicit block only see the lumped mass. The damage c and b are solved on both blocks, so
+#damage can start anywhere and the zone grows as soon as an explicit element is damaged.
+#dt is limited by the explicit block only.
+#Cost: this is one global NEWTON solve over all dofs. Every nonlinear iteration evaluates
+#the explicit kernels again (their residual does not change within the step) and the
+#Jacobian and the ASM factorization include the explicit block, where the displacement
+#part is diagonal and the damage part is a reaction-diffusion matrix. The far field is
+#therefore cheaper than an implicit far field, but it does not run at the cost of a pure
+#explicit update.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+  xmax = 1.0
+  ymax = 1.0
+[]
+
+[MeshModifiers]
+  [./crack_zone]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.45 0'
+    top_right = '0.35 0.55 0'
+  [../]
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./c]
+  [../]
+  [./b]
+  [../]
+[]
+
+[AuxVariables]
+  [./vel_x]
+  [../]
+  [./vel_y]
+  [../]
+  [./accel_x]
+  [../]
+  [./accel_y]
+  [../]
+[]
+
+[ICs]
+  [./notch]
+    type = BoundingBoxIC
+    variable = c
+    x1 = 0.0
+    y1 = 0.495
+    x2 = 0.3
+    y2 = 0.505
+    inside = 1.0
+    outside = 0.0
+  [../]
+[]
+
+[Functions]
+  [./tfunc]
+    type = ParsedFunction
+    value = 10*t
+  [../]
+[]
+
+[Kernels]
+  #Both blocks
+  [./inertia_x]
+    type = InertialForceExp
+    variable = disp_x
+    use_lumped_mass = true
+    use_displaced_mesh = false
+  [../]
+  [./inertia_y]
+    type = InertialForceExp
+    variable = disp_y
+    use_lumped_mass = true
+    use_displaced_mesh = false
+  [../]
+  [./dcdt]
+    type = TimeDerivative
+    variable = c
+  [../]
+  [./pfintvar]
+    type = Reaction
+    variable = b
+  [../]
+  [./pfbulk]
+    type = PFFracBulkRateModify
+    variable = c
+    l = 0.02
+    beta = b
+    visco = 1e-4
+    kdamage = 1e-8
+    gc_prop_var = 'gc_prop'
+    G0_var = 'G0_pos'
+    dG0_dstrain_var = 'dG0_pos_dstrain'
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+  [./pfintcoupled]
+    type = PFFracCoupledInterface
+    variable = b
+    c = c
+  [../]
+
+  #Explicit block
+  [./explicit_x]
+    type = StressDivergenceExplicitTensors
+    variable = disp_x
+    component = 0
+    block = 0
+    cache_stiffness = true
+  [../]
+  [./explicit_y]
+    type = StressDivergenceExplicitTensors
+    variable = disp_y
+    component = 1
+    block = 0
+    cache_stiffness = true
+  [../]
+
+  #Implicit crack zone
+  [./implicit_x]
+    type = StressDivergenceTensors
+    variable = disp_x
+    component = 0
+    block = 1
+  [../]
+  [./implicit_y]
+    type = StressDivergenceTensors
+    variable = disp_y
+    component = 1
+    block = 1
+  [../]
+  [./offdiag_x]
+    type = PhaseFieldFractureMechanicsOffDiag
+    variable = disp_x
+    component = 0
+    c = c
+    block = 1
+  [../]
+  [./offdiag_y]
+    type = PhaseFieldFractureMechanicsOffDiag
+    variable = disp_y
+    component = 1
+    c = c
+    block = 1
+  [../]
+[]
+
+[BCs]
+  [./ydisp]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = top
+    function = tfunc
+  [../]
+  [./yfix]
+    type = PresetBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./xfix]
+    type = PresetBC
+    variable = disp_x
+    boundary = 'bottom top'
+    value = 0
+  [../]
+[]
+
+[Materials]
+  #Defined on both blocks, so moved elements keep their stateful properties
+  [./pfbulkmat]
+    type = PFFracBulkRateMaterial
+    gc = 1e-3
+  [../]
+  [./elastic]
+    type = LinearIsoElasticPFDamageModify
+    c = c
+    kdamage = 1e-8
+  [../]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensor
+    C_ijkl = '120.0 80.0'
+    fill_method = symmetric_isotropic
+  [../]
+  [./strain]
+    type = ComputeSmallStrain
+  [../]
+  [./density]
+    type = GenericConstantMaterial
+    prop_names = density
+    prop_values = 1e-3
+  [../]
+[]
+
+[UserObjects]
+  [./nodal_update]
+    type = ExplicitNodalUpdate
+    scheme = central_difference
+    velocities = 'vel_x vel_y'
+    accelerations = 'accel_x accel_y'
+  [../]
+  [./crack_zone]
+    type = CrackZoneSubdomainModifier
+    damage = c
+    damage_threshold = 0.01
+    explicit_block = 0
+    implicit_block = 1
+    buffer_layers = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./resid_y]
+    type = BoundaryReactionForce
+    component = 1
+    boundary = top
+  [../]
+  [./dc_max]
+    type = MaxDamageIncrement
+    variable = c
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -sub_pc_type -pc_asm_overlap'
+  petsc_options_value = 'asm      lu           1'
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-12
+  l_max_its = 30
+  nl_max_its = 10
+
+  #Stable for the explicit block: h / sqrt((lambda + 2 mu) / rho) = 1.9e-5
+  dt = 5e-6
+  num_steps = 400
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+[]
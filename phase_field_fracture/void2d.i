@@ -1,5 +1,5 @@
 [Mesh]
-  type = FileMesh
+  type = CachedFileMesh
   file = void2d_mesh.xda
 []
 
@@ -19,10 +19,6 @@
 []
 
 [AuxVariables]
-  [./resid_x]
-  [../]
-  [./resid_y]
-  [../]
   [./stress_yy]
     order = CONSTANT
     family = MONOMIAL
@@ -49,7 +45,6 @@
   [../]
   [./TensorMechanics]
     displacements = 'disp_x disp_y'
-    save_in = 'resid_x resid_y'
   [../]
   [./solid_x]
     type = PhaseFieldFractureMechanicsOffDiag
@@ -123,10 +118,17 @@
 
 [Materials]
   [./pfbulkmat]
-    type = PFFracBulkRateMaterial
+    type = CachedFunctionMaterial
     block = 0
+    prop_name = gc_prop
     function = gb_prop_func
   [../]
+  [./void_prop]
+    type = CachedFunctionMaterial
+    block = 0
+    prop_name = void_prop
+    function = void_prop_func
+  [../]
   [./elastic]
     type = LinearIsoElasticPFDamage
     block = 0
@@ -134,11 +136,11 @@
     kdamage = 1e-8
   [../]
   [./elasticity_tensor]
-    type = ComputeElasticityTensor
+    type = ComputeScaledElasticityTensor
     block = 0
     C_ijkl = '120.0 80.0'
     fill_method = symmetric_isotropic
-    elasticity_tensor_prefactor = void_prop_func
+    prefactor = void_prop
   [../]
   [./strain]
     type = ComputeSmallStrain
@@ -149,13 +151,13 @@
 
 [Postprocessors]
   [./resid_x]
-    type = NodalSum
-    variable = resid_x
+    type = BoundaryReactionForce
+    component = 0
     boundary = left
   [../]
   [./resid_y]
-    type = NodalSum
-    variable = resid_y
+    type = BoundaryReactionForce
+    component = 1
     boundary = top
   [../]
 []